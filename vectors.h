@@ -44,14 +44,17 @@ STATIC_ASSERT(sizeof(real) == 0x4, real_size_wrong);
 #if defined(__cplusplus)
     #define REAL_MATH_1_ARG(func, x)      (func)(x)
     #define REAL_MATH_2_ARG(func, x, y)   (func)((x), (y))
+    #define REAL_MATH_3_ARG(func, x, y, z) (func)((x), (y), (z))
 
 #elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
     #if VECTORS_REAL_IS_FLOAT
         #define REAL_MATH_1_ARG(func, x)      func ## f(x)
         #define REAL_MATH_2_ARG(func, x, y)   func ## f((x), (y))
+        #define REAL_MATH_3_ARG(func, x, y, z) func ## f((x), (y), (z))
     #else
         #define REAL_MATH_1_ARG(func, x)      func(x)
         #define REAL_MATH_2_ARG(func, x, y)   func((x), (y))
+        #define REAL_MATH_3_ARG(func, x, y, z) func((x), (y), (z))
     #endif
 
 #else
@@ -75,6 +78,7 @@ STATIC_ASSERT(sizeof(real) == 0x4, real_size_wrong);
 #define real_abs(x)    REAL_MATH_1_ARG(fabs, x)
 #define real_sqrt(x)   REAL_MATH_1_ARG(sqrt, x)
 #define real_pow(x,y)  REAL_MATH_2_ARG(pow, x, y)
+#define real_exp(x)    REAL_MATH_1_ARG(exp, x)
 
 /* C++ & C99+ - define macros to use the fmin, fmax, trunc library functions. */
 #if defined(__cplusplus) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
@@ -88,6 +92,16 @@ STATIC_ASSERT(sizeof(real) == 0x4, real_size_wrong);
     static real real_trunc(real x)  { return (x) >= 0 ? real_floor(x) : real_ceil(x); }
 #endif
 
+/* Multiply-add (x * y + z). Define VECTORS_USE_FMA to route multiply-adds (dot, cross, lerp, mat4_mul,
+   quat_mul, vec*_fma) through the C99/C++ fma function - one rounding instead of two. Only enable it when
+   the target has hardware FMA (e.g. -mfma, /arch:AVX2), otherwise fma is a slow software routine. Ignored
+   in C89. */
+#if defined(VECTORS_USE_FMA) && (defined(__cplusplus) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L))
+    #define real_fma(x,y,z)  REAL_MATH_3_ARG(fma, x, y, z)
+#else
+    #define real_fma(x,y,z)  ((x) * (y) + (z))
+#endif
+
 /* Real constants. */
 #define VECTORS_PI ((real)3.14159265358979323846)
 static const real VECTORS_RAD2DEG = (real)(180.0 / VECTORS_PI);
@@ -436,6 +450,67 @@ typedef union vec4
 } vec4;
 STATIC_ASSERT(sizeof(vec4) == 0x10, vec4_size_wrong);
 
+/* 2-component 32-bit signed integer vector. */
+typedef union ivec2
+{
+    i32 components[2];
+    struct { i32 x, y; } position;
+    struct { i32 s, t; } textcoord;
+} ivec2;
+STATIC_ASSERT(sizeof(ivec2) == 0x8, ivec2_size_wrong);
+
+/* 3-component 32-bit signed integer vector. */
+typedef union ivec3
+{
+    i32 components[3];
+    struct { i32 x, y, z; } position;
+    struct { i32 s, t, p; } textcoord;
+	ivec2 ivec2;
+} ivec3;
+STATIC_ASSERT(sizeof(ivec3) == 0xC, ivec3_size_wrong);
+
+/* 4-component 32-bit signed integer vector. */
+typedef union ivec4
+{
+    i32 components[4];
+    struct { i32 x, y, z, w; } position;
+    struct { i32 s, t, p, q; } textcoord;
+	ivec3 ivec3;
+} ivec4;
+STATIC_ASSERT(sizeof(ivec4) == 0x10, ivec4_size_wrong);
+
+/* 2-component 32-bit unsigned integer vector. */
+typedef union uvec2
+{
+    u32 components[2];
+    struct { u32 x, y; } position;
+    struct { u32 r, g; } color;
+    struct { u32 s, t; } textcoord;
+} uvec2;
+STATIC_ASSERT(sizeof(uvec2) == 0x8, uvec2_size_wrong);
+
+/* 3-component 32-bit unsigned integer vector. */
+typedef union uvec3
+{
+    u32 components[3];
+    struct { u32 x, y, z; } position;
+    struct { u32 r, g, b; } color;
+    struct { u32 s, t, p; } textcoord;
+	uvec2 uvec2;
+} uvec3;
+STATIC_ASSERT(sizeof(uvec3) == 0xC, uvec3_size_wrong);
+
+/* 4-component 32-bit unsigned integer vector. */
+typedef union uvec4
+{
+    u32 components[4];
+    struct { u32 x, y, z, w; } position;
+    struct { u32 r, g, b, a; } color;
+    struct { u32 s, t, p, q; } textcoord;
+	uvec3 uvec3;
+} uvec4;
+STATIC_ASSERT(sizeof(uvec4) == 0x10, uvec4_size_wrong);
+
 typedef union mat2
 {
 	real data[4];
@@ -777,11 +852,115 @@ static bool vec2_any(vec2 src0)
     return rets;
 }
 
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_eq(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_ne(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_lt(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_le(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_gt(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with vec2_mask). */
+static u32 vec2_ge(vec2 src0, vec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Gathers the sign bit of each component into a MASK_* bitmask (like SSE movemask). */
+static u32 vec2_movemask(vec2 src0)
+{
+    union { vec2 vector; uvec2 lanes; } bits;
+    u32 mask;
+    bits.vector = src0;
+    mask = (
+        ((bits.lanes.components[0] >> 31) << _0) |
+        ((bits.lanes.components[1] >> 31) << _1));
+    return mask;
+}
+
+/* Branch-free bitwise blend: bits of src0 where lanes are set, otherwise src1 (see uvec2_from_mask). */
+static vec2 vec2_select(vec2 src0, vec2 src1, uvec2 lanes)
+{
+    union { vec2 vector; uvec2 lanes; } selected, other;
+    selected.vector = src0;
+    other.vector    = src1;
+    selected.lanes.components[0] = (selected.lanes.components[0] & lanes.components[0]) | (other.lanes.components[0] & ~lanes.components[0]);
+    selected.lanes.components[1] = (selected.lanes.components[1] & lanes.components[1]) | (other.lanes.components[1] & ~lanes.components[1]);
+    return selected.vector;
+}
+
+/* Per-component fused multiply-add (multiplicand * multiplier + addend). */
+static vec2 vec2_fma(vec2 multiplicand, vec2 multiplier, vec2 addend)
+{
+    vec2 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    return rets;
+}
+
+/* Per-component fused multiply-subtract (multiplicand * multiplier - addend). */
+static vec2 vec2_fms(vec2 multiplicand, vec2 multiplier, vec2 addend)
+{
+    vec2 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], -addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], -addend.components[1]);
+    return rets;
+}
+
+/* Per-component fused negated multiply-add (addend - multiplicand * multiplier). */
+static vec2 vec2_fnma(vec2 multiplicand, vec2 multiplier, vec2 addend)
+{
+    vec2 rets;
+    rets.components[0] = real_fma(-multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(-multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    return rets;
+}
+
 /* 2-component dot product. */
 static real vec2_dot(vec2 src0, vec2 src1)
 {
     real dot_product;
-    dot_product = (src0.components[0] * src1.components[0]) + (src0.components[1] * src1.components[1]);
+    dot_product = real_fma(src0.components[1], src1.components[1], src0.components[0] * src1.components[0]);
     return dot_product;
 }
 
@@ -789,8 +968,7 @@ static real vec2_dot(vec2 src0, vec2 src1)
 static vec2 vec2_lerp(vec2 src0, vec2 src1, real t)
 {
     vec2 difference = vec2_sub(src1, src0);
-    vec2 scaled = vec2_mul_scalar(difference, t);
-    vec2 interpolated = vec2_add(src0, scaled);
+    vec2 interpolated = vec2_fma(difference, vec2_init_from_1(t), src0);
     return interpolated;
 }
 
@@ -1305,11 +1483,128 @@ static bool vec3_any(vec3 src0)
     return rets;
 }
 
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_eq(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_ne(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_lt(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_le(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_gt(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with vec3_mask). */
+static u32 vec3_ge(vec3 src0, vec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Gathers the sign bit of each component into a MASK_* bitmask (like SSE movemask). */
+static u32 vec3_movemask(vec3 src0)
+{
+    union { vec3 vector; uvec3 lanes; } bits;
+    u32 mask;
+    bits.vector = src0;
+    mask = (
+        ((bits.lanes.components[0] >> 31) << _0) |
+        ((bits.lanes.components[1] >> 31) << _1) |
+        ((bits.lanes.components[2] >> 31) << _2));
+    return mask;
+}
+
+/* Branch-free bitwise blend: bits of src0 where lanes are set, otherwise src1 (see uvec3_from_mask). */
+static vec3 vec3_select(vec3 src0, vec3 src1, uvec3 lanes)
+{
+    union { vec3 vector; uvec3 lanes; } selected, other;
+    selected.vector = src0;
+    other.vector    = src1;
+    selected.lanes.components[0] = (selected.lanes.components[0] & lanes.components[0]) | (other.lanes.components[0] & ~lanes.components[0]);
+    selected.lanes.components[1] = (selected.lanes.components[1] & lanes.components[1]) | (other.lanes.components[1] & ~lanes.components[1]);
+    selected.lanes.components[2] = (selected.lanes.components[2] & lanes.components[2]) | (other.lanes.components[2] & ~lanes.components[2]);
+    return selected.vector;
+}
+
+/* Per-component fused multiply-add (multiplicand * multiplier + addend). */
+static vec3 vec3_fma(vec3 multiplicand, vec3 multiplier, vec3 addend)
+{
+    vec3 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    rets.components[2] = real_fma(multiplicand.components[2], multiplier.components[2], addend.components[2]);
+    return rets;
+}
+
+/* Per-component fused multiply-subtract (multiplicand * multiplier - addend). */
+static vec3 vec3_fms(vec3 multiplicand, vec3 multiplier, vec3 addend)
+{
+    vec3 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], -addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], -addend.components[1]);
+    rets.components[2] = real_fma(multiplicand.components[2], multiplier.components[2], -addend.components[2]);
+    return rets;
+}
+
+/* Per-component fused negated multiply-add (addend - multiplicand * multiplier). */
+static vec3 vec3_fnma(vec3 multiplicand, vec3 multiplier, vec3 addend)
+{
+    vec3 rets;
+    rets.components[0] = real_fma(-multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(-multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    rets.components[2] = real_fma(-multiplicand.components[2], multiplier.components[2], addend.components[2]);
+    return rets;
+}
+
 /* 3-component dot product. */
 static real vec3_dot(vec3 src0, vec3 src1)
 {
     real dot_product;
-    dot_product = (src0.components[0] * src1.components[0]) + (src0.components[1] * src1.components[1]) + (src0.components[2] * src1.components[2]);
+    dot_product = src0.components[0] * src1.components[0];
+    dot_product = real_fma(src0.components[1], src1.components[1], dot_product);
+    dot_product = real_fma(src0.components[2], src1.components[2], dot_product);
     return dot_product;
 }
 
@@ -1317,8 +1612,7 @@ static real vec3_dot(vec3 src0, vec3 src1)
 static vec3 vec3_lerp(vec3 src0, vec3 src1, real t)
 {
     vec3 difference = vec3_sub(src1, src0);
-    vec3 scaled = vec3_mul_scalar(difference, t);
-    vec3 interpolated = vec3_add(src0, scaled);
+    vec3 interpolated = vec3_fma(difference, vec3_init_from_1(t), src0);
     return interpolated;
 }
 
@@ -1401,9 +1695,9 @@ static vec3 vec3_radians(vec3 degrees)
 static vec3 vec3_cross(vec3 src0, vec3 src1)
 {
     vec3 cross_product;
-    cross_product.components[0] = (src0.components[1] * src1.components[2]) - (src1.components[1] * src0.components[2]);
-    cross_product.components[1] = (src0.components[2] * src1.components[0]) - (src1.components[2] * src0.components[0]);
-    cross_product.components[2] = (src0.components[0] * src1.components[1]) - (src1.components[0] * src0.components[1]);
+    cross_product.components[0] = real_fma(src0.components[1], src1.components[2], -(src1.components[1] * src0.components[2]));
+    cross_product.components[1] = real_fma(src0.components[2], src1.components[0], -(src1.components[2] * src0.components[0]));
+    cross_product.components[2] = real_fma(src0.components[0], src1.components[1], -(src1.components[0] * src0.components[1]));
     return cross_product;
 }
 
@@ -1876,14 +2170,139 @@ static bool vec4_any(vec4 src0)
     return rets;
 }
 
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_eq(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2) |
+        ((u32)(src0.components[3] == src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_ne(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2) |
+        ((u32)(src0.components[3] != src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_lt(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2) |
+        ((u32)(src0.components[3] < src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_le(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] <= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_gt(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2) |
+        ((u32)(src0.components[3] > src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with vec4_mask). */
+static u32 vec4_ge(vec4 src0, vec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] >= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Gathers the sign bit of each component into a MASK_* bitmask (like SSE movemask). */
+static u32 vec4_movemask(vec4 src0)
+{
+    union { vec4 vector; uvec4 lanes; } bits;
+    u32 mask;
+    bits.vector = src0;
+    mask = (
+        ((bits.lanes.components[0] >> 31) << _0) |
+        ((bits.lanes.components[1] >> 31) << _1) |
+        ((bits.lanes.components[2] >> 31) << _2) |
+        ((bits.lanes.components[3] >> 31) << _3));
+    return mask;
+}
+
+/* Branch-free bitwise blend: bits of src0 where lanes are set, otherwise src1 (see uvec4_from_mask). */
+static vec4 vec4_select(vec4 src0, vec4 src1, uvec4 lanes)
+{
+    union { vec4 vector; uvec4 lanes; } selected, other;
+    selected.vector = src0;
+    other.vector    = src1;
+    selected.lanes.components[0] = (selected.lanes.components[0] & lanes.components[0]) | (other.lanes.components[0] & ~lanes.components[0]);
+    selected.lanes.components[1] = (selected.lanes.components[1] & lanes.components[1]) | (other.lanes.components[1] & ~lanes.components[1]);
+    selected.lanes.components[2] = (selected.lanes.components[2] & lanes.components[2]) | (other.lanes.components[2] & ~lanes.components[2]);
+    selected.lanes.components[3] = (selected.lanes.components[3] & lanes.components[3]) | (other.lanes.components[3] & ~lanes.components[3]);
+    return selected.vector;
+}
+
+/* Per-component fused multiply-add (multiplicand * multiplier + addend). */
+static vec4 vec4_fma(vec4 multiplicand, vec4 multiplier, vec4 addend)
+{
+    vec4 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    rets.components[2] = real_fma(multiplicand.components[2], multiplier.components[2], addend.components[2]);
+    rets.components[3] = real_fma(multiplicand.components[3], multiplier.components[3], addend.components[3]);
+    return rets;
+}
+
+/* Per-component fused multiply-subtract (multiplicand * multiplier - addend). */
+static vec4 vec4_fms(vec4 multiplicand, vec4 multiplier, vec4 addend)
+{
+    vec4 rets;
+    rets.components[0] = real_fma(multiplicand.components[0], multiplier.components[0], -addend.components[0]);
+    rets.components[1] = real_fma(multiplicand.components[1], multiplier.components[1], -addend.components[1]);
+    rets.components[2] = real_fma(multiplicand.components[2], multiplier.components[2], -addend.components[2]);
+    rets.components[3] = real_fma(multiplicand.components[3], multiplier.components[3], -addend.components[3]);
+    return rets;
+}
+
+/* Per-component fused negated multiply-add (addend - multiplicand * multiplier). */
+static vec4 vec4_fnma(vec4 multiplicand, vec4 multiplier, vec4 addend)
+{
+    vec4 rets;
+    rets.components[0] = real_fma(-multiplicand.components[0], multiplier.components[0], addend.components[0]);
+    rets.components[1] = real_fma(-multiplicand.components[1], multiplier.components[1], addend.components[1]);
+    rets.components[2] = real_fma(-multiplicand.components[2], multiplier.components[2], addend.components[2]);
+    rets.components[3] = real_fma(-multiplicand.components[3], multiplier.components[3], addend.components[3]);
+    return rets;
+}
+
 /* Four-component dot product. */
 static real vec4_dot(vec4 src0, vec4 src1)
 {
-    real dot_product = 0.0f;
-    dot_product += (src0.components[0] * src1.components[0]);
-    dot_product += (src0.components[1] * src1.components[1]);
-    dot_product += (src0.components[2] * src1.components[2]);
-    dot_product += (src0.components[3] * src1.components[3]);
+    real dot_product = src0.components[0] * src1.components[0];
+    dot_product = real_fma(src0.components[1], src1.components[1], dot_product);
+    dot_product = real_fma(src0.components[2], src1.components[2], dot_product);
+    dot_product = real_fma(src0.components[3], src1.components[3], dot_product);
     return dot_product;
 }
 
@@ -1891,8 +2310,7 @@ static real vec4_dot(vec4 src0, vec4 src1)
 static vec4 vec4_lerp(vec4 src0, vec4 src1, real t)
 {
     vec4 difference = vec4_sub(src1, src0);
-    vec4 scaled = vec4_mul_scalar(difference, t);
-    vec4 interpolated = vec4_add(src0, scaled);
+    vec4 interpolated = vec4_fma(difference, vec4_init_from_1(t), src0);
     return interpolated;
 }
 
@@ -1976,9 +2394,9 @@ static vec4 vec4_radians(vec4 degrees)
 static vec4 vec4_cross(vec4 src0, vec4 src1)
 {
     vec4 cross_product;
-    cross_product.components[0] = (src0.components[1] * src1.components[2]) - (src1.components[1] * src0.components[2]);
-    cross_product.components[1] = (src0.components[2] * src1.components[0]) - (src1.components[2] * src0.components[0]);
-    cross_product.components[2] = (src0.components[0] * src1.components[1]) - (src1.components[0] * src0.components[1]);
+    cross_product.components[0] = real_fma(src0.components[1], src1.components[2], -(src1.components[1] * src0.components[2]));
+    cross_product.components[1] = real_fma(src0.components[2], src1.components[0], -(src1.components[2] * src0.components[0]));
+    cross_product.components[2] = real_fma(src0.components[0], src1.components[1], -(src1.components[0] * src0.components[1]));
     cross_product.components[3] = 1.0f;
     return cross_product;
 }
@@ -2099,158 +2517,2174 @@ static vec4 vec4_invert_color(vec4 color)
 }
 
 /* -------------------------------------------------------------------------
-   3x3 matrix operations
+   Integer vector operations (ivec* = i32, uvec* = u32)
    ------------------------------------------------------------------------- */
 
-/* Construct a mat3 from a quaternion. */
-static mat3 mat3_from_quat(vec4 q)
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static ivec2 ivec2_mask(ivec2 src0, ivec2 src1, u32 mask)
 {
-    real xx = q.position.x * q.position.x;
-    real yy = q.position.y * q.position.y;
-    real zz = q.position.z * q.position.z;
-    real xy = q.position.x * q.position.y;
-    real xz = q.position.x * q.position.z;
-    real yz = q.position.y * q.position.z;
-    real wx = q.rotation.w * q.position.x;
-    real wy = q.rotation.w * q.position.y;
-    real wz = q.rotation.w * q.position.z;
-    mat3 m;
-    m.data[0] = 1.0f - 2.0f * (yy + zz);
-    m.data[1] = 2.0f * (xy - wz);
-    m.data[2] = 2.0f * (xz + wy);
-    m.data[3] = 2.0f * (xy + wz);
-    m.data[4] = 1.0f - 2.0f * (xx + zz);
-    m.data[5] = 2.0f * (yz - wx);
-    m.data[6] = 2.0f * (xz - wy);
-    m.data[7] = 2.0f * (yz + wx);
-    m.data[8] = 1.0f - 2.0f * (xx + yy);
-    return m;
+    ivec2 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    return masked;
 }
 
-/* Transpose a mat3 (swap rows and columns). */
-static mat3 mat3_transpose(mat3 m)
+/* Initialize an ivec2 from 2 i32's, where each component maps to an argument. */
+static ivec2 ivec2_init_from_2(i32 src0, i32 src1)
 {
-    mat3 t;
-    t.data[0] = m.data[0];
-    t.data[1] = m.data[3];
-    t.data[2] = m.data[6];
-    t.data[3] = m.data[1];
-    t.data[4] = m.data[4];
-    t.data[5] = m.data[7];
-    t.data[6] = m.data[2];
-    t.data[7] = m.data[5];
-    t.data[8] = m.data[8];
-    return t;
+    ivec2 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    return vector;
 }
 
-/* Multiply two mat3 matrices. */
-static mat3 mat3_mul(mat3 a, mat3 b)
+/* Initialize an ivec2 from one i32, where all components map to the argument. */
+static ivec2 ivec2_init_from_1(i32 src0)
 {
-    mat3 r;
-    i32 i, j, k;
-    for (i = 0; i < 3; i++)
-    {
-        for (j = 0; j < 3; j++)
-        {
-            real sum = 0;
-            for (k = 0; k < 3; k++)
-            {
-                sum += a.data[i * 3 + k] * b.data[k * 3 + j];
-            }
-            r.data[i * 3 + j] = sum;
-        }
-    }
-    return r;
+    ivec2 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    return vector;
 }
 
-/* Multiply a mat3 by a vec3. */
-static vec3 mat3_mul_vec3(mat3 m, vec3 v)
+/* Per-component negation (sign flip). */
+static ivec2 ivec2_negate(ivec2 src0)
 {
-    vec3 result;
-    result.position.x = m.data[0] * v.position.x + m.data[1] * v.position.y + m.data[2] * v.position.z;
-    result.position.y = m.data[3] * v.position.x + m.data[4] * v.position.y + m.data[5] * v.position.z;
-    result.position.z = m.data[6] * v.position.x + m.data[7] * v.position.y + m.data[8] * v.position.z;
-    return result;
+    ivec2 negative;
+    negative.components[0] = -src0.components[0];
+    negative.components[1] = -src0.components[1];
+    return negative;
 }
 
-/* Inverse of a diagonal 3x3 matrix.
-   Assumes data[1],data[2],data[3],data[5],data[6],data[7] are zero.
-   Returns a mat3 with reciprocals on the diagonal (or zero where original is zero). */
-static mat3 mat3_inverse_diagonal(mat3 m) {
-    mat3 r;
-    r.data[0] = m.data[0] != 0.0f ? 1.0f / m.data[0] : 0.0f;
-    r.data[1] = 0.0f; r.data[2] = 0.0f;
-    r.data[3] = 0.0f;
-    r.data[4] = m.data[4] != 0.0f ? 1.0f / m.data[4] : 0.0f;
-    r.data[5] = 0.0f;
-    r.data[6] = 0.0f; r.data[7] = 0.0f;
-    r.data[8] = m.data[8] != 0.0f ? 1.0f / m.data[8] : 0.0f;
-    return r;
+/* Per-component addition of two ivec2. */
+static ivec2 ivec2_add(ivec2 augend, ivec2 addend)
+{
+    ivec2 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    return sum;
 }
 
-/* -------------------------------------------------------------------------
-   4x4 matrix operations
-   ------------------------------------------------------------------------- */
+/* Per-component addition of an ivec2 and a scalar. */
+static ivec2 ivec2_add_scalar(ivec2 augend, i32 addend)
+{
+    ivec2 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    return sum;
+}
 
-/* Create an identity mat4 (1's on diagonal, 0's elsewhere). */
-static mat4 mat4_identity(void)
+/* Per-component subtraction of two ivec2. */
+static ivec2 ivec2_sub(ivec2 minuend, ivec2 subtrahend)
 {
-    mat4 r;
-    i32 i;
-    for (i = 0; i < 16; i++)
-    {
-        r.data[i] = 0;
-    }
-    r.transpose[0][0] = 1;
-    r.transpose[1][1] = 1;
-    r.transpose[2][2] = 1;
-    r.transpose[3][3] = 1;
-    return r;
+    ivec2 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    return difference;
 }
 
-/* Multiply two mat4 matrices. */
-static mat4 mat4_mul(mat4 a, mat4 b)
+/* Per-component subtraction of an ivec2 and a scalar. */
+static ivec2 ivec2_sub_scalar(ivec2 minuend, i32 subtrahend)
 {
-    mat4 r;
-    i32 i, j, k;
-    for (i = 0; i < 4; i++)
-    {
-        for (j = 0; j < 4; j++)
-        {
-            r.transpose[i][j] = 0;
-            for (k = 0; k < 4; k++)
-            {
-                r.transpose[i][j] += a.transpose[i][k] * b.transpose[k][j];
-            }
-        }
-    }
-    return r;
+    ivec2 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    return difference;
 }
 
-/* Multiply a mat4 by a vec4. */
-static vec4 mat4_mul_vec4(mat4 m, vec4 v)
+/* Per-component multiplication of two ivec2. */
+static ivec2 ivec2_mul(ivec2 multiplicand, ivec2 multiplier)
 {
-    vec4 result;
-    result.position.x = m.transpose[0][0] * v.position.x + m.transpose[0][1] * v.position.y + m.transpose[0][2] * v.position.z + m.transpose[0][3] * v.rotation.w;
-    result.position.y = m.transpose[1][0] * v.position.x + m.transpose[1][1] * v.position.y + m.transpose[1][2] * v.position.z + m.transpose[1][3] * v.rotation.w;
-    result.position.z = m.transpose[2][0] * v.position.x + m.transpose[2][1] * v.position.y + m.transpose[2][2] * v.position.z + m.transpose[2][3] * v.rotation.w;
-    result.rotation.w = m.transpose[3][0] * v.position.x + m.transpose[3][1] * v.position.y + m.transpose[3][2] * v.position.z + m.transpose[3][3] * v.rotation.w;
+    ivec2 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    return product;
+}
+
+/* Per-component multiplication of an ivec2 and a scalar. */
+static ivec2 ivec2_mul_scalar(ivec2 multiplicand, i32 multiplier)
+{
+    ivec2 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    return product;
+}
+
+/* Per-component absolute-value. */
+static ivec2 ivec2_abs(ivec2 src0)
+{
+    ivec2 rets;
+    rets.components[0] = src0.components[0] < 0 ? -src0.components[0] : src0.components[0];
+    rets.components[1] = src0.components[1] < 0 ? -src0.components[1] : src0.components[1];
+    return rets;
+}
+
+/* Per-component maximum of two ivec2. */
+static ivec2 ivec2_max(ivec2 src0, ivec2 src1)
+{
+    ivec2 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    return maximum;
+}
+
+/* Per-component minimum of two ivec2. */
+static ivec2 ivec2_min(ivec2 src0, ivec2 src1)
+{
+    ivec2 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static ivec2 ivec2_clamp(ivec2 src0, ivec2 minimum, ivec2 maximum)
+{
+    ivec2 clamped_lower  = ivec2_max(src0, minimum);
+    ivec2 clamped        = ivec2_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static ivec2 ivec2_clamp_scalar(ivec2 src0, i32 minimum, i32 maximum)
+{
+    ivec2 clamped_lower  = ivec2_max(src0, ivec2_init_from_1(minimum));
+    ivec2 clamped        = ivec2_min(clamped_lower, ivec2_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static ivec2 ivec2_shift_left(ivec2 src0, u32 bits)
+{
+    ivec2 shifted;
+    shifted.components[0] = (i32)((u32)src0.components[0] << bits);
+    shifted.components[1] = (i32)((u32)src0.components[1] << bits);
+    return shifted;
+}
+
+/* Per-component arithmetic right shift, rounding towards -inf (bits must be less than 32). */
+static ivec2 ivec2_shift_right(ivec2 src0, u32 bits)
+{
+    ivec2 shifted;
+    shifted.components[0] = src0.components[0] >= 0 ? src0.components[0] >> bits : ~(~src0.components[0] >> bits);
+    shifted.components[1] = src0.components[1] >= 0 ? src0.components[1] >> bits : ~(~src0.components[1] >> bits);
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static ivec2 ivec2_and(ivec2 src0, ivec2 src1)
+{
+    ivec2 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static ivec2 ivec2_or(ivec2 src0, ivec2 src1)
+{
+    ivec2 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static ivec2 ivec2_xor(ivec2 src0, ivec2 src1)
+{
+    ivec2 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static ivec2 ivec2_not(ivec2 src0)
+{
+    ivec2 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_eq(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_ne(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_lt(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_le(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_gt(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with ivec2_mask/vec2_mask). */
+static u32 ivec2_ge(ivec2 src0, ivec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0. */
+static ivec2 ivec2_from_vec2_trunc(vec2 src0)
+{
+    ivec2 truncated;
+    truncated.components[0] = (i32)src0.components[0];
+    truncated.components[1] = (i32)src0.components[1];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (no libm call). */
+static ivec2 ivec2_from_vec2_floor(vec2 src0)
+{
+    ivec2 floored;
+    floored.components[0] = (i32)src0.components[0];
+    floored.components[0] -= (src0.components[0] < (real)floored.components[0]);
+    floored.components[1] = (i32)src0.components[1];
+    floored.components[1] -= (src0.components[1] < (real)floored.components[1]);
+    return floored;
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded away from 0. */
+static ivec2 ivec2_from_vec2_round(vec2 src0)
+{
+    ivec2 rounded;
+    rounded.components[0] = (i32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f) - (src0.components[0] - (real)rounded.components[0] <= -0.5f);
+    rounded.components[1] = (i32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f) - (src0.components[1] - (real)rounded.components[1] <= -0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of an ivec2 to a vec2. */
+static vec2 vec2_from_ivec2(ivec2 src0)
+{
+    vec2 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    return converted;
+}
+
+/* Per-component reinterpretation of a uvec2 as an ivec2 (two's complement). */
+static ivec2 ivec2_from_uvec2(uvec2 src0)
+{
+    ivec2 converted;
+    converted.components[0] = (i32)src0.components[0];
+    converted.components[1] = (i32)src0.components[1];
+    return converted;
+}
+
+
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static ivec3 ivec3_mask(ivec3 src0, ivec3 src1, u32 mask)
+{
+    ivec3 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    masked.components[2] = mask & MASK_2 ? src0.components[2] : src1.components[2];
+    return masked;
+}
+
+/* Initialize an ivec3 from 3 i32's, where each component maps to an argument. */
+static ivec3 ivec3_init_from_3(i32 src0, i32 src1, i32 src2)
+{
+    ivec3 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    vector.components[2] = src2;
+    return vector;
+}
+
+/* Initialize an ivec3 from one i32, where all components map to the argument. */
+static ivec3 ivec3_init_from_1(i32 src0)
+{
+    ivec3 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    vector.components[2] = src0;
+    return vector;
+}
+
+/* Per-component negation (sign flip). */
+static ivec3 ivec3_negate(ivec3 src0)
+{
+    ivec3 negative;
+    negative.components[0] = -src0.components[0];
+    negative.components[1] = -src0.components[1];
+    negative.components[2] = -src0.components[2];
+    return negative;
+}
+
+/* Per-component addition of two ivec3. */
+static ivec3 ivec3_add(ivec3 augend, ivec3 addend)
+{
+    ivec3 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    sum.components[2] = augend.components[2] + addend.components[2];
+    return sum;
+}
+
+/* Per-component addition of an ivec3 and a scalar. */
+static ivec3 ivec3_add_scalar(ivec3 augend, i32 addend)
+{
+    ivec3 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    sum.components[2] = augend.components[2] + addend;
+    return sum;
+}
+
+/* Per-component subtraction of two ivec3. */
+static ivec3 ivec3_sub(ivec3 minuend, ivec3 subtrahend)
+{
+    ivec3 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    difference.components[2] = minuend.components[2] - subtrahend.components[2];
+    return difference;
+}
+
+/* Per-component subtraction of an ivec3 and a scalar. */
+static ivec3 ivec3_sub_scalar(ivec3 minuend, i32 subtrahend)
+{
+    ivec3 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    difference.components[2] = minuend.components[2] - subtrahend;
+    return difference;
+}
+
+/* Per-component multiplication of two ivec3. */
+static ivec3 ivec3_mul(ivec3 multiplicand, ivec3 multiplier)
+{
+    ivec3 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    product.components[2] = multiplicand.components[2] * multiplier.components[2];
+    return product;
+}
+
+/* Per-component multiplication of an ivec3 and a scalar. */
+static ivec3 ivec3_mul_scalar(ivec3 multiplicand, i32 multiplier)
+{
+    ivec3 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    product.components[2] = multiplicand.components[2] * multiplier;
+    return product;
+}
+
+/* Per-component absolute-value. */
+static ivec3 ivec3_abs(ivec3 src0)
+{
+    ivec3 rets;
+    rets.components[0] = src0.components[0] < 0 ? -src0.components[0] : src0.components[0];
+    rets.components[1] = src0.components[1] < 0 ? -src0.components[1] : src0.components[1];
+    rets.components[2] = src0.components[2] < 0 ? -src0.components[2] : src0.components[2];
+    return rets;
+}
+
+/* Per-component maximum of two ivec3. */
+static ivec3 ivec3_max(ivec3 src0, ivec3 src1)
+{
+    ivec3 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    maximum.components[2] = src0.components[2] > src1.components[2] ? src0.components[2] : src1.components[2];
+    return maximum;
+}
+
+/* Per-component minimum of two ivec3. */
+static ivec3 ivec3_min(ivec3 src0, ivec3 src1)
+{
+    ivec3 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    minimum.components[2] = src0.components[2] < src1.components[2] ? src0.components[2] : src1.components[2];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static ivec3 ivec3_clamp(ivec3 src0, ivec3 minimum, ivec3 maximum)
+{
+    ivec3 clamped_lower  = ivec3_max(src0, minimum);
+    ivec3 clamped        = ivec3_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static ivec3 ivec3_clamp_scalar(ivec3 src0, i32 minimum, i32 maximum)
+{
+    ivec3 clamped_lower  = ivec3_max(src0, ivec3_init_from_1(minimum));
+    ivec3 clamped        = ivec3_min(clamped_lower, ivec3_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static ivec3 ivec3_shift_left(ivec3 src0, u32 bits)
+{
+    ivec3 shifted;
+    shifted.components[0] = (i32)((u32)src0.components[0] << bits);
+    shifted.components[1] = (i32)((u32)src0.components[1] << bits);
+    shifted.components[2] = (i32)((u32)src0.components[2] << bits);
+    return shifted;
+}
+
+/* Per-component arithmetic right shift, rounding towards -inf (bits must be less than 32). */
+static ivec3 ivec3_shift_right(ivec3 src0, u32 bits)
+{
+    ivec3 shifted;
+    shifted.components[0] = src0.components[0] >= 0 ? src0.components[0] >> bits : ~(~src0.components[0] >> bits);
+    shifted.components[1] = src0.components[1] >= 0 ? src0.components[1] >> bits : ~(~src0.components[1] >> bits);
+    shifted.components[2] = src0.components[2] >= 0 ? src0.components[2] >> bits : ~(~src0.components[2] >> bits);
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static ivec3 ivec3_and(ivec3 src0, ivec3 src1)
+{
+    ivec3 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    rets.components[2] = src0.components[2] & src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static ivec3 ivec3_or(ivec3 src0, ivec3 src1)
+{
+    ivec3 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    rets.components[2] = src0.components[2] | src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static ivec3 ivec3_xor(ivec3 src0, ivec3 src1)
+{
+    ivec3 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    rets.components[2] = src0.components[2] ^ src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static ivec3 ivec3_not(ivec3 src0)
+{
+    ivec3 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    rets.components[2] = ~src0.components[2];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_eq(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_ne(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_lt(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_le(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_gt(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with ivec3_mask/vec3_mask). */
+static u32 ivec3_ge(ivec3 src0, ivec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0. */
+static ivec3 ivec3_from_vec3_trunc(vec3 src0)
+{
+    ivec3 truncated;
+    truncated.components[0] = (i32)src0.components[0];
+    truncated.components[1] = (i32)src0.components[1];
+    truncated.components[2] = (i32)src0.components[2];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (no libm call). */
+static ivec3 ivec3_from_vec3_floor(vec3 src0)
+{
+    ivec3 floored;
+    floored.components[0] = (i32)src0.components[0];
+    floored.components[0] -= (src0.components[0] < (real)floored.components[0]);
+    floored.components[1] = (i32)src0.components[1];
+    floored.components[1] -= (src0.components[1] < (real)floored.components[1]);
+    floored.components[2] = (i32)src0.components[2];
+    floored.components[2] -= (src0.components[2] < (real)floored.components[2]);
+    return floored;
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded away from 0. */
+static ivec3 ivec3_from_vec3_round(vec3 src0)
+{
+    ivec3 rounded;
+    rounded.components[0] = (i32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f) - (src0.components[0] - (real)rounded.components[0] <= -0.5f);
+    rounded.components[1] = (i32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f) - (src0.components[1] - (real)rounded.components[1] <= -0.5f);
+    rounded.components[2] = (i32)src0.components[2];
+    rounded.components[2] += (src0.components[2] - (real)rounded.components[2] >= 0.5f) - (src0.components[2] - (real)rounded.components[2] <= -0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of an ivec3 to a vec3. */
+static vec3 vec3_from_ivec3(ivec3 src0)
+{
+    vec3 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    converted.components[2] = (real)src0.components[2];
+    return converted;
+}
+
+/* Per-component reinterpretation of a uvec3 as an ivec3 (two's complement). */
+static ivec3 ivec3_from_uvec3(uvec3 src0)
+{
+    ivec3 converted;
+    converted.components[0] = (i32)src0.components[0];
+    converted.components[1] = (i32)src0.components[1];
+    converted.components[2] = (i32)src0.components[2];
+    return converted;
+}
+
+
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static ivec4 ivec4_mask(ivec4 src0, ivec4 src1, u32 mask)
+{
+    ivec4 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    masked.components[2] = mask & MASK_2 ? src0.components[2] : src1.components[2];
+    masked.components[3] = mask & MASK_3 ? src0.components[3] : src1.components[3];
+    return masked;
+}
+
+/* Initialize an ivec4 from 4 i32's, where each component maps to an argument. */
+static ivec4 ivec4_init_from_4(i32 src0, i32 src1, i32 src2, i32 src3)
+{
+    ivec4 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    vector.components[2] = src2;
+    vector.components[3] = src3;
+    return vector;
+}
+
+/* Initialize an ivec4 from one i32, where all components map to the argument. */
+static ivec4 ivec4_init_from_1(i32 src0)
+{
+    ivec4 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    vector.components[2] = src0;
+    vector.components[3] = src0;
+    return vector;
+}
+
+/* Per-component negation (sign flip). */
+static ivec4 ivec4_negate(ivec4 src0)
+{
+    ivec4 negative;
+    negative.components[0] = -src0.components[0];
+    negative.components[1] = -src0.components[1];
+    negative.components[2] = -src0.components[2];
+    negative.components[3] = -src0.components[3];
+    return negative;
+}
+
+/* Per-component addition of two ivec4. */
+static ivec4 ivec4_add(ivec4 augend, ivec4 addend)
+{
+    ivec4 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    sum.components[2] = augend.components[2] + addend.components[2];
+    sum.components[3] = augend.components[3] + addend.components[3];
+    return sum;
+}
+
+/* Per-component addition of an ivec4 and a scalar. */
+static ivec4 ivec4_add_scalar(ivec4 augend, i32 addend)
+{
+    ivec4 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    sum.components[2] = augend.components[2] + addend;
+    sum.components[3] = augend.components[3] + addend;
+    return sum;
+}
+
+/* Per-component subtraction of two ivec4. */
+static ivec4 ivec4_sub(ivec4 minuend, ivec4 subtrahend)
+{
+    ivec4 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    difference.components[2] = minuend.components[2] - subtrahend.components[2];
+    difference.components[3] = minuend.components[3] - subtrahend.components[3];
+    return difference;
+}
+
+/* Per-component subtraction of an ivec4 and a scalar. */
+static ivec4 ivec4_sub_scalar(ivec4 minuend, i32 subtrahend)
+{
+    ivec4 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    difference.components[2] = minuend.components[2] - subtrahend;
+    difference.components[3] = minuend.components[3] - subtrahend;
+    return difference;
+}
+
+/* Per-component multiplication of two ivec4. */
+static ivec4 ivec4_mul(ivec4 multiplicand, ivec4 multiplier)
+{
+    ivec4 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    product.components[2] = multiplicand.components[2] * multiplier.components[2];
+    product.components[3] = multiplicand.components[3] * multiplier.components[3];
+    return product;
+}
+
+/* Per-component multiplication of an ivec4 and a scalar. */
+static ivec4 ivec4_mul_scalar(ivec4 multiplicand, i32 multiplier)
+{
+    ivec4 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    product.components[2] = multiplicand.components[2] * multiplier;
+    product.components[3] = multiplicand.components[3] * multiplier;
+    return product;
+}
+
+/* Per-component absolute-value. */
+static ivec4 ivec4_abs(ivec4 src0)
+{
+    ivec4 rets;
+    rets.components[0] = src0.components[0] < 0 ? -src0.components[0] : src0.components[0];
+    rets.components[1] = src0.components[1] < 0 ? -src0.components[1] : src0.components[1];
+    rets.components[2] = src0.components[2] < 0 ? -src0.components[2] : src0.components[2];
+    rets.components[3] = src0.components[3] < 0 ? -src0.components[3] : src0.components[3];
+    return rets;
+}
+
+/* Per-component maximum of two ivec4. */
+static ivec4 ivec4_max(ivec4 src0, ivec4 src1)
+{
+    ivec4 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    maximum.components[2] = src0.components[2] > src1.components[2] ? src0.components[2] : src1.components[2];
+    maximum.components[3] = src0.components[3] > src1.components[3] ? src0.components[3] : src1.components[3];
+    return maximum;
+}
+
+/* Per-component minimum of two ivec4. */
+static ivec4 ivec4_min(ivec4 src0, ivec4 src1)
+{
+    ivec4 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    minimum.components[2] = src0.components[2] < src1.components[2] ? src0.components[2] : src1.components[2];
+    minimum.components[3] = src0.components[3] < src1.components[3] ? src0.components[3] : src1.components[3];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static ivec4 ivec4_clamp(ivec4 src0, ivec4 minimum, ivec4 maximum)
+{
+    ivec4 clamped_lower  = ivec4_max(src0, minimum);
+    ivec4 clamped        = ivec4_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static ivec4 ivec4_clamp_scalar(ivec4 src0, i32 minimum, i32 maximum)
+{
+    ivec4 clamped_lower  = ivec4_max(src0, ivec4_init_from_1(minimum));
+    ivec4 clamped        = ivec4_min(clamped_lower, ivec4_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static ivec4 ivec4_shift_left(ivec4 src0, u32 bits)
+{
+    ivec4 shifted;
+    shifted.components[0] = (i32)((u32)src0.components[0] << bits);
+    shifted.components[1] = (i32)((u32)src0.components[1] << bits);
+    shifted.components[2] = (i32)((u32)src0.components[2] << bits);
+    shifted.components[3] = (i32)((u32)src0.components[3] << bits);
+    return shifted;
+}
+
+/* Per-component arithmetic right shift, rounding towards -inf (bits must be less than 32). */
+static ivec4 ivec4_shift_right(ivec4 src0, u32 bits)
+{
+    ivec4 shifted;
+    shifted.components[0] = src0.components[0] >= 0 ? src0.components[0] >> bits : ~(~src0.components[0] >> bits);
+    shifted.components[1] = src0.components[1] >= 0 ? src0.components[1] >> bits : ~(~src0.components[1] >> bits);
+    shifted.components[2] = src0.components[2] >= 0 ? src0.components[2] >> bits : ~(~src0.components[2] >> bits);
+    shifted.components[3] = src0.components[3] >= 0 ? src0.components[3] >> bits : ~(~src0.components[3] >> bits);
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static ivec4 ivec4_and(ivec4 src0, ivec4 src1)
+{
+    ivec4 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    rets.components[2] = src0.components[2] & src1.components[2];
+    rets.components[3] = src0.components[3] & src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static ivec4 ivec4_or(ivec4 src0, ivec4 src1)
+{
+    ivec4 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    rets.components[2] = src0.components[2] | src1.components[2];
+    rets.components[3] = src0.components[3] | src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static ivec4 ivec4_xor(ivec4 src0, ivec4 src1)
+{
+    ivec4 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    rets.components[2] = src0.components[2] ^ src1.components[2];
+    rets.components[3] = src0.components[3] ^ src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static ivec4 ivec4_not(ivec4 src0)
+{
+    ivec4 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    rets.components[2] = ~src0.components[2];
+    rets.components[3] = ~src0.components[3];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_eq(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2) |
+        ((u32)(src0.components[3] == src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_ne(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2) |
+        ((u32)(src0.components[3] != src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_lt(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2) |
+        ((u32)(src0.components[3] < src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_le(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] <= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_gt(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2) |
+        ((u32)(src0.components[3] > src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with ivec4_mask/vec4_mask). */
+static u32 ivec4_ge(ivec4 src0, ivec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] >= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0. */
+static ivec4 ivec4_from_vec4_trunc(vec4 src0)
+{
+    ivec4 truncated;
+    truncated.components[0] = (i32)src0.components[0];
+    truncated.components[1] = (i32)src0.components[1];
+    truncated.components[2] = (i32)src0.components[2];
+    truncated.components[3] = (i32)src0.components[3];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (no libm call). */
+static ivec4 ivec4_from_vec4_floor(vec4 src0)
+{
+    ivec4 floored;
+    floored.components[0] = (i32)src0.components[0];
+    floored.components[0] -= (src0.components[0] < (real)floored.components[0]);
+    floored.components[1] = (i32)src0.components[1];
+    floored.components[1] -= (src0.components[1] < (real)floored.components[1]);
+    floored.components[2] = (i32)src0.components[2];
+    floored.components[2] -= (src0.components[2] < (real)floored.components[2]);
+    floored.components[3] = (i32)src0.components[3];
+    floored.components[3] -= (src0.components[3] < (real)floored.components[3]);
+    return floored;
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded away from 0. */
+static ivec4 ivec4_from_vec4_round(vec4 src0)
+{
+    ivec4 rounded;
+    rounded.components[0] = (i32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f) - (src0.components[0] - (real)rounded.components[0] <= -0.5f);
+    rounded.components[1] = (i32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f) - (src0.components[1] - (real)rounded.components[1] <= -0.5f);
+    rounded.components[2] = (i32)src0.components[2];
+    rounded.components[2] += (src0.components[2] - (real)rounded.components[2] >= 0.5f) - (src0.components[2] - (real)rounded.components[2] <= -0.5f);
+    rounded.components[3] = (i32)src0.components[3];
+    rounded.components[3] += (src0.components[3] - (real)rounded.components[3] >= 0.5f) - (src0.components[3] - (real)rounded.components[3] <= -0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of an ivec4 to a vec4. */
+static vec4 vec4_from_ivec4(ivec4 src0)
+{
+    vec4 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    converted.components[2] = (real)src0.components[2];
+    converted.components[3] = (real)src0.components[3];
+    return converted;
+}
+
+/* Per-component reinterpretation of a uvec4 as an ivec4 (two's complement). */
+static ivec4 ivec4_from_uvec4(uvec4 src0)
+{
+    ivec4 converted;
+    converted.components[0] = (i32)src0.components[0];
+    converted.components[1] = (i32)src0.components[1];
+    converted.components[2] = (i32)src0.components[2];
+    converted.components[3] = (i32)src0.components[3];
+    return converted;
+}
+
+
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static uvec2 uvec2_mask(uvec2 src0, uvec2 src1, u32 mask)
+{
+    uvec2 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    return masked;
+}
+
+/* Initialize a uvec2 from 2 u32's, where each component maps to an argument. */
+static uvec2 uvec2_init_from_2(u32 src0, u32 src1)
+{
+    uvec2 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    return vector;
+}
+
+/* Initialize a uvec2 from one u32, where all components map to the argument. */
+static uvec2 uvec2_init_from_1(u32 src0)
+{
+    uvec2 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    return vector;
+}
+
+/* Per-component addition of two uvec2 (wraps on overflow). */
+static uvec2 uvec2_add(uvec2 augend, uvec2 addend)
+{
+    uvec2 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    return sum;
+}
+
+/* Per-component addition of a uvec2 and a scalar. */
+static uvec2 uvec2_add_scalar(uvec2 augend, u32 addend)
+{
+    uvec2 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    return sum;
+}
+
+/* Per-component subtraction of two uvec2 (wraps on overflow). */
+static uvec2 uvec2_sub(uvec2 minuend, uvec2 subtrahend)
+{
+    uvec2 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    return difference;
+}
+
+/* Per-component subtraction of a uvec2 and a scalar. */
+static uvec2 uvec2_sub_scalar(uvec2 minuend, u32 subtrahend)
+{
+    uvec2 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    return difference;
+}
+
+/* Per-component multiplication of two uvec2 (wraps on overflow). */
+static uvec2 uvec2_mul(uvec2 multiplicand, uvec2 multiplier)
+{
+    uvec2 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    return product;
+}
+
+/* Per-component multiplication of a uvec2 and a scalar. */
+static uvec2 uvec2_mul_scalar(uvec2 multiplicand, u32 multiplier)
+{
+    uvec2 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    return product;
+}
+
+/* Per-component maximum of two uvec2. */
+static uvec2 uvec2_max(uvec2 src0, uvec2 src1)
+{
+    uvec2 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    return maximum;
+}
+
+/* Per-component minimum of two uvec2. */
+static uvec2 uvec2_min(uvec2 src0, uvec2 src1)
+{
+    uvec2 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static uvec2 uvec2_clamp(uvec2 src0, uvec2 minimum, uvec2 maximum)
+{
+    uvec2 clamped_lower  = uvec2_max(src0, minimum);
+    uvec2 clamped        = uvec2_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static uvec2 uvec2_clamp_scalar(uvec2 src0, u32 minimum, u32 maximum)
+{
+    uvec2 clamped_lower  = uvec2_max(src0, uvec2_init_from_1(minimum));
+    uvec2 clamped        = uvec2_min(clamped_lower, uvec2_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static uvec2 uvec2_shift_left(uvec2 src0, u32 bits)
+{
+    uvec2 shifted;
+    shifted.components[0] = src0.components[0] << bits;
+    shifted.components[1] = src0.components[1] << bits;
+    return shifted;
+}
+
+/* Per-component logical right shift (bits must be less than 32). */
+static uvec2 uvec2_shift_right(uvec2 src0, u32 bits)
+{
+    uvec2 shifted;
+    shifted.components[0] = src0.components[0] >> bits;
+    shifted.components[1] = src0.components[1] >> bits;
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static uvec2 uvec2_and(uvec2 src0, uvec2 src1)
+{
+    uvec2 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static uvec2 uvec2_or(uvec2 src0, uvec2 src1)
+{
+    uvec2 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static uvec2 uvec2_xor(uvec2 src0, uvec2 src1)
+{
+    uvec2 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static uvec2 uvec2_not(uvec2 src0)
+{
+    uvec2 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_eq(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_ne(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_lt(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_le(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_gt(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with uvec2_mask/vec2_mask). */
+static u32 uvec2_ge(uvec2 src0, uvec2 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0 (src0 must be non-negative). */
+static uvec2 uvec2_from_vec2_trunc(vec2 src0)
+{
+    uvec2 truncated;
+    truncated.components[0] = (u32)src0.components[0];
+    truncated.components[1] = (u32)src0.components[1];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (src0 must be non-negative). */
+static uvec2 uvec2_from_vec2_floor(vec2 src0)
+{
+    return uvec2_from_vec2_trunc(src0);
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded up (src0 must be non-negative). */
+static uvec2 uvec2_from_vec2_round(vec2 src0)
+{
+    uvec2 rounded;
+    rounded.components[0] = (u32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f);
+    rounded.components[1] = (u32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of a uvec2 to a vec2. */
+static vec2 vec2_from_uvec2(uvec2 src0)
+{
+    vec2 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    return converted;
+}
+
+/* Per-component reinterpretation of an ivec2 as a uvec2 (two's complement). */
+static uvec2 uvec2_from_ivec2(ivec2 src0)
+{
+    uvec2 converted;
+    converted.components[0] = (u32)src0.components[0];
+    converted.components[1] = (u32)src0.components[1];
+    return converted;
+}
+
+/* Expands a MASK_* bitmask into per-component lane masks (all ones or all zeros), for *_select. */
+static uvec2 uvec2_from_mask(u32 mask)
+{
+    uvec2 lanes;
+    lanes.components[0] = 0u - ((mask >> _0) & 1u);
+    lanes.components[1] = 0u - ((mask >> _1) & 1u);
+    return lanes;
+}
+
+/* Collapses per-component lane masks back into a MASK_* bitmask (top bit of each component). */
+static u32 uvec2_movemask(uvec2 lanes)
+{
+    u32 mask = (
+        ((lanes.components[0] >> 31) << _0) |
+        ((lanes.components[1] >> 31) << _1));
+    return mask;
+}
+
+
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static uvec3 uvec3_mask(uvec3 src0, uvec3 src1, u32 mask)
+{
+    uvec3 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    masked.components[2] = mask & MASK_2 ? src0.components[2] : src1.components[2];
+    return masked;
+}
+
+/* Initialize a uvec3 from 3 u32's, where each component maps to an argument. */
+static uvec3 uvec3_init_from_3(u32 src0, u32 src1, u32 src2)
+{
+    uvec3 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    vector.components[2] = src2;
+    return vector;
+}
+
+/* Initialize a uvec3 from one u32, where all components map to the argument. */
+static uvec3 uvec3_init_from_1(u32 src0)
+{
+    uvec3 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    vector.components[2] = src0;
+    return vector;
+}
+
+/* Per-component addition of two uvec3 (wraps on overflow). */
+static uvec3 uvec3_add(uvec3 augend, uvec3 addend)
+{
+    uvec3 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    sum.components[2] = augend.components[2] + addend.components[2];
+    return sum;
+}
+
+/* Per-component addition of a uvec3 and a scalar. */
+static uvec3 uvec3_add_scalar(uvec3 augend, u32 addend)
+{
+    uvec3 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    sum.components[2] = augend.components[2] + addend;
+    return sum;
+}
+
+/* Per-component subtraction of two uvec3 (wraps on overflow). */
+static uvec3 uvec3_sub(uvec3 minuend, uvec3 subtrahend)
+{
+    uvec3 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    difference.components[2] = minuend.components[2] - subtrahend.components[2];
+    return difference;
+}
+
+/* Per-component subtraction of a uvec3 and a scalar. */
+static uvec3 uvec3_sub_scalar(uvec3 minuend, u32 subtrahend)
+{
+    uvec3 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    difference.components[2] = minuend.components[2] - subtrahend;
+    return difference;
+}
+
+/* Per-component multiplication of two uvec3 (wraps on overflow). */
+static uvec3 uvec3_mul(uvec3 multiplicand, uvec3 multiplier)
+{
+    uvec3 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    product.components[2] = multiplicand.components[2] * multiplier.components[2];
+    return product;
+}
+
+/* Per-component multiplication of a uvec3 and a scalar. */
+static uvec3 uvec3_mul_scalar(uvec3 multiplicand, u32 multiplier)
+{
+    uvec3 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    product.components[2] = multiplicand.components[2] * multiplier;
+    return product;
+}
+
+/* Per-component maximum of two uvec3. */
+static uvec3 uvec3_max(uvec3 src0, uvec3 src1)
+{
+    uvec3 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    maximum.components[2] = src0.components[2] > src1.components[2] ? src0.components[2] : src1.components[2];
+    return maximum;
+}
+
+/* Per-component minimum of two uvec3. */
+static uvec3 uvec3_min(uvec3 src0, uvec3 src1)
+{
+    uvec3 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    minimum.components[2] = src0.components[2] < src1.components[2] ? src0.components[2] : src1.components[2];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static uvec3 uvec3_clamp(uvec3 src0, uvec3 minimum, uvec3 maximum)
+{
+    uvec3 clamped_lower  = uvec3_max(src0, minimum);
+    uvec3 clamped        = uvec3_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static uvec3 uvec3_clamp_scalar(uvec3 src0, u32 minimum, u32 maximum)
+{
+    uvec3 clamped_lower  = uvec3_max(src0, uvec3_init_from_1(minimum));
+    uvec3 clamped        = uvec3_min(clamped_lower, uvec3_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static uvec3 uvec3_shift_left(uvec3 src0, u32 bits)
+{
+    uvec3 shifted;
+    shifted.components[0] = src0.components[0] << bits;
+    shifted.components[1] = src0.components[1] << bits;
+    shifted.components[2] = src0.components[2] << bits;
+    return shifted;
+}
+
+/* Per-component logical right shift (bits must be less than 32). */
+static uvec3 uvec3_shift_right(uvec3 src0, u32 bits)
+{
+    uvec3 shifted;
+    shifted.components[0] = src0.components[0] >> bits;
+    shifted.components[1] = src0.components[1] >> bits;
+    shifted.components[2] = src0.components[2] >> bits;
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static uvec3 uvec3_and(uvec3 src0, uvec3 src1)
+{
+    uvec3 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    rets.components[2] = src0.components[2] & src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static uvec3 uvec3_or(uvec3 src0, uvec3 src1)
+{
+    uvec3 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    rets.components[2] = src0.components[2] | src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static uvec3 uvec3_xor(uvec3 src0, uvec3 src1)
+{
+    uvec3 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    rets.components[2] = src0.components[2] ^ src1.components[2];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static uvec3 uvec3_not(uvec3 src0)
+{
+    uvec3 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    rets.components[2] = ~src0.components[2];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_eq(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_ne(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_lt(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_le(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_gt(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with uvec3_mask/vec3_mask). */
+static u32 uvec3_ge(uvec3 src0, uvec3 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0 (src0 must be non-negative). */
+static uvec3 uvec3_from_vec3_trunc(vec3 src0)
+{
+    uvec3 truncated;
+    truncated.components[0] = (u32)src0.components[0];
+    truncated.components[1] = (u32)src0.components[1];
+    truncated.components[2] = (u32)src0.components[2];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (src0 must be non-negative). */
+static uvec3 uvec3_from_vec3_floor(vec3 src0)
+{
+    return uvec3_from_vec3_trunc(src0);
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded up (src0 must be non-negative). */
+static uvec3 uvec3_from_vec3_round(vec3 src0)
+{
+    uvec3 rounded;
+    rounded.components[0] = (u32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f);
+    rounded.components[1] = (u32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f);
+    rounded.components[2] = (u32)src0.components[2];
+    rounded.components[2] += (src0.components[2] - (real)rounded.components[2] >= 0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of a uvec3 to a vec3. */
+static vec3 vec3_from_uvec3(uvec3 src0)
+{
+    vec3 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    converted.components[2] = (real)src0.components[2];
+    return converted;
+}
+
+/* Per-component reinterpretation of an ivec3 as a uvec3 (two's complement). */
+static uvec3 uvec3_from_ivec3(ivec3 src0)
+{
+    uvec3 converted;
+    converted.components[0] = (u32)src0.components[0];
+    converted.components[1] = (u32)src0.components[1];
+    converted.components[2] = (u32)src0.components[2];
+    return converted;
+}
+
+/* Expands a MASK_* bitmask into per-component lane masks (all ones or all zeros), for *_select. */
+static uvec3 uvec3_from_mask(u32 mask)
+{
+    uvec3 lanes;
+    lanes.components[0] = 0u - ((mask >> _0) & 1u);
+    lanes.components[1] = 0u - ((mask >> _1) & 1u);
+    lanes.components[2] = 0u - ((mask >> _2) & 1u);
+    return lanes;
+}
+
+/* Collapses per-component lane masks back into a MASK_* bitmask (top bit of each component). */
+static u32 uvec3_movemask(uvec3 lanes)
+{
+    u32 mask = (
+        ((lanes.components[0] >> 31) << _0) |
+        ((lanes.components[1] >> 31) << _1) |
+        ((lanes.components[2] >> 31) << _2));
+    return mask;
+}
+
+
+/* Selects components from src0 if the corresponding bit in the mask is set, otherwise selects from src1. */
+static uvec4 uvec4_mask(uvec4 src0, uvec4 src1, u32 mask)
+{
+    uvec4 masked;
+    masked.components[0] = mask & MASK_0 ? src0.components[0] : src1.components[0];
+    masked.components[1] = mask & MASK_1 ? src0.components[1] : src1.components[1];
+    masked.components[2] = mask & MASK_2 ? src0.components[2] : src1.components[2];
+    masked.components[3] = mask & MASK_3 ? src0.components[3] : src1.components[3];
+    return masked;
+}
+
+/* Initialize a uvec4 from 4 u32's, where each component maps to an argument. */
+static uvec4 uvec4_init_from_4(u32 src0, u32 src1, u32 src2, u32 src3)
+{
+    uvec4 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src1;
+    vector.components[2] = src2;
+    vector.components[3] = src3;
+    return vector;
+}
+
+/* Initialize a uvec4 from one u32, where all components map to the argument. */
+static uvec4 uvec4_init_from_1(u32 src0)
+{
+    uvec4 vector;
+    vector.components[0] = src0;
+    vector.components[1] = src0;
+    vector.components[2] = src0;
+    vector.components[3] = src0;
+    return vector;
+}
+
+/* Per-component addition of two uvec4 (wraps on overflow). */
+static uvec4 uvec4_add(uvec4 augend, uvec4 addend)
+{
+    uvec4 sum;
+    sum.components[0] = augend.components[0] + addend.components[0];
+    sum.components[1] = augend.components[1] + addend.components[1];
+    sum.components[2] = augend.components[2] + addend.components[2];
+    sum.components[3] = augend.components[3] + addend.components[3];
+    return sum;
+}
+
+/* Per-component addition of a uvec4 and a scalar. */
+static uvec4 uvec4_add_scalar(uvec4 augend, u32 addend)
+{
+    uvec4 sum;
+    sum.components[0] = augend.components[0] + addend;
+    sum.components[1] = augend.components[1] + addend;
+    sum.components[2] = augend.components[2] + addend;
+    sum.components[3] = augend.components[3] + addend;
+    return sum;
+}
+
+/* Per-component subtraction of two uvec4 (wraps on overflow). */
+static uvec4 uvec4_sub(uvec4 minuend, uvec4 subtrahend)
+{
+    uvec4 difference;
+    difference.components[0] = minuend.components[0] - subtrahend.components[0];
+    difference.components[1] = minuend.components[1] - subtrahend.components[1];
+    difference.components[2] = minuend.components[2] - subtrahend.components[2];
+    difference.components[3] = minuend.components[3] - subtrahend.components[3];
+    return difference;
+}
+
+/* Per-component subtraction of a uvec4 and a scalar. */
+static uvec4 uvec4_sub_scalar(uvec4 minuend, u32 subtrahend)
+{
+    uvec4 difference;
+    difference.components[0] = minuend.components[0] - subtrahend;
+    difference.components[1] = minuend.components[1] - subtrahend;
+    difference.components[2] = minuend.components[2] - subtrahend;
+    difference.components[3] = minuend.components[3] - subtrahend;
+    return difference;
+}
+
+/* Per-component multiplication of two uvec4 (wraps on overflow). */
+static uvec4 uvec4_mul(uvec4 multiplicand, uvec4 multiplier)
+{
+    uvec4 product;
+    product.components[0] = multiplicand.components[0] * multiplier.components[0];
+    product.components[1] = multiplicand.components[1] * multiplier.components[1];
+    product.components[2] = multiplicand.components[2] * multiplier.components[2];
+    product.components[3] = multiplicand.components[3] * multiplier.components[3];
+    return product;
+}
+
+/* Per-component multiplication of a uvec4 and a scalar. */
+static uvec4 uvec4_mul_scalar(uvec4 multiplicand, u32 multiplier)
+{
+    uvec4 product;
+    product.components[0] = multiplicand.components[0] * multiplier;
+    product.components[1] = multiplicand.components[1] * multiplier;
+    product.components[2] = multiplicand.components[2] * multiplier;
+    product.components[3] = multiplicand.components[3] * multiplier;
+    return product;
+}
+
+/* Per-component maximum of two uvec4. */
+static uvec4 uvec4_max(uvec4 src0, uvec4 src1)
+{
+    uvec4 maximum;
+    maximum.components[0] = src0.components[0] > src1.components[0] ? src0.components[0] : src1.components[0];
+    maximum.components[1] = src0.components[1] > src1.components[1] ? src0.components[1] : src1.components[1];
+    maximum.components[2] = src0.components[2] > src1.components[2] ? src0.components[2] : src1.components[2];
+    maximum.components[3] = src0.components[3] > src1.components[3] ? src0.components[3] : src1.components[3];
+    return maximum;
+}
+
+/* Per-component minimum of two uvec4. */
+static uvec4 uvec4_min(uvec4 src0, uvec4 src1)
+{
+    uvec4 minimum;
+    minimum.components[0] = src0.components[0] < src1.components[0] ? src0.components[0] : src1.components[0];
+    minimum.components[1] = src0.components[1] < src1.components[1] ? src0.components[1] : src1.components[1];
+    minimum.components[2] = src0.components[2] < src1.components[2] ? src0.components[2] : src1.components[2];
+    minimum.components[3] = src0.components[3] < src1.components[3] ? src0.components[3] : src1.components[3];
+    return minimum;
+}
+
+/* Per-component clamp of src0 into the range of vectors (minimum..maximum). */
+static uvec4 uvec4_clamp(uvec4 src0, uvec4 minimum, uvec4 maximum)
+{
+    uvec4 clamped_lower  = uvec4_max(src0, minimum);
+    uvec4 clamped        = uvec4_min(clamped_lower, maximum);
+    return clamped;
+}
+
+/* Per-component clamp of src0 into the range of scalars (minimum..maximum). */
+static uvec4 uvec4_clamp_scalar(uvec4 src0, u32 minimum, u32 maximum)
+{
+    uvec4 clamped_lower  = uvec4_max(src0, uvec4_init_from_1(minimum));
+    uvec4 clamped        = uvec4_min(clamped_lower, uvec4_init_from_1(maximum));
+    return clamped;
+}
+
+/* Per-component left shift (bits must be less than 32). */
+static uvec4 uvec4_shift_left(uvec4 src0, u32 bits)
+{
+    uvec4 shifted;
+    shifted.components[0] = src0.components[0] << bits;
+    shifted.components[1] = src0.components[1] << bits;
+    shifted.components[2] = src0.components[2] << bits;
+    shifted.components[3] = src0.components[3] << bits;
+    return shifted;
+}
+
+/* Per-component logical right shift (bits must be less than 32). */
+static uvec4 uvec4_shift_right(uvec4 src0, u32 bits)
+{
+    uvec4 shifted;
+    shifted.components[0] = src0.components[0] >> bits;
+    shifted.components[1] = src0.components[1] >> bits;
+    shifted.components[2] = src0.components[2] >> bits;
+    shifted.components[3] = src0.components[3] >> bits;
+    return shifted;
+}
+
+/* Per-component bitwise AND. */
+static uvec4 uvec4_and(uvec4 src0, uvec4 src1)
+{
+    uvec4 rets;
+    rets.components[0] = src0.components[0] & src1.components[0];
+    rets.components[1] = src0.components[1] & src1.components[1];
+    rets.components[2] = src0.components[2] & src1.components[2];
+    rets.components[3] = src0.components[3] & src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise OR. */
+static uvec4 uvec4_or(uvec4 src0, uvec4 src1)
+{
+    uvec4 rets;
+    rets.components[0] = src0.components[0] | src1.components[0];
+    rets.components[1] = src0.components[1] | src1.components[1];
+    rets.components[2] = src0.components[2] | src1.components[2];
+    rets.components[3] = src0.components[3] | src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise XOR. */
+static uvec4 uvec4_xor(uvec4 src0, uvec4 src1)
+{
+    uvec4 rets;
+    rets.components[0] = src0.components[0] ^ src1.components[0];
+    rets.components[1] = src0.components[1] ^ src1.components[1];
+    rets.components[2] = src0.components[2] ^ src1.components[2];
+    rets.components[3] = src0.components[3] ^ src1.components[3];
+    return rets;
+}
+
+/* Per-component bitwise complement. */
+static uvec4 uvec4_not(uvec4 src0)
+{
+    uvec4 rets;
+    rets.components[0] = ~src0.components[0];
+    rets.components[1] = ~src0.components[1];
+    rets.components[2] = ~src0.components[2];
+    rets.components[3] = ~src0.components[3];
+    return rets;
+}
+
+/* Per-component equal to comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_eq(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] == src1.components[0]) << _0) |
+        ((u32)(src0.components[1] == src1.components[1]) << _1) |
+        ((u32)(src0.components[2] == src1.components[2]) << _2) |
+        ((u32)(src0.components[3] == src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component not equal to comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_ne(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] != src1.components[0]) << _0) |
+        ((u32)(src0.components[1] != src1.components[1]) << _1) |
+        ((u32)(src0.components[2] != src1.components[2]) << _2) |
+        ((u32)(src0.components[3] != src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_lt(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] < src1.components[0]) << _0) |
+        ((u32)(src0.components[1] < src1.components[1]) << _1) |
+        ((u32)(src0.components[2] < src1.components[2]) << _2) |
+        ((u32)(src0.components[3] < src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component less than or equal to comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_le(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] <= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] <= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] <= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] <= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_gt(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] > src1.components[0]) << _0) |
+        ((u32)(src0.components[1] > src1.components[1]) << _1) |
+        ((u32)(src0.components[2] > src1.components[2]) << _2) |
+        ((u32)(src0.components[3] > src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component greater than or equal to comparison, returned as a MASK_* bitmask (usable with uvec4_mask/vec4_mask). */
+static u32 uvec4_ge(uvec4 src0, uvec4 src1)
+{
+    u32 mask = (
+        ((u32)(src0.components[0] >= src1.components[0]) << _0) |
+        ((u32)(src0.components[1] >= src1.components[1]) << _1) |
+        ((u32)(src0.components[2] >= src1.components[2]) << _2) |
+        ((u32)(src0.components[3] >= src1.components[3]) << _3));
+    return mask;
+}
+
+/* Per-component conversion to the closest integer rounded towards 0 (src0 must be non-negative). */
+static uvec4 uvec4_from_vec4_trunc(vec4 src0)
+{
+    uvec4 truncated;
+    truncated.components[0] = (u32)src0.components[0];
+    truncated.components[1] = (u32)src0.components[1];
+    truncated.components[2] = (u32)src0.components[2];
+    truncated.components[3] = (u32)src0.components[3];
+    return truncated;
+}
+
+/* Per-component conversion to the closest integer rounded towards -inf (src0 must be non-negative). */
+static uvec4 uvec4_from_vec4_floor(vec4 src0)
+{
+    return uvec4_from_vec4_trunc(src0);
+}
+
+/* Per-component conversion to the nearest integer, halfway cases rounded up (src0 must be non-negative). */
+static uvec4 uvec4_from_vec4_round(vec4 src0)
+{
+    uvec4 rounded;
+    rounded.components[0] = (u32)src0.components[0];
+    rounded.components[0] += (src0.components[0] - (real)rounded.components[0] >= 0.5f);
+    rounded.components[1] = (u32)src0.components[1];
+    rounded.components[1] += (src0.components[1] - (real)rounded.components[1] >= 0.5f);
+    rounded.components[2] = (u32)src0.components[2];
+    rounded.components[2] += (src0.components[2] - (real)rounded.components[2] >= 0.5f);
+    rounded.components[3] = (u32)src0.components[3];
+    rounded.components[3] += (src0.components[3] - (real)rounded.components[3] >= 0.5f);
+    return rounded;
+}
+
+/* Per-component conversion of a uvec4 to a vec4. */
+static vec4 vec4_from_uvec4(uvec4 src0)
+{
+    vec4 converted;
+    converted.components[0] = (real)src0.components[0];
+    converted.components[1] = (real)src0.components[1];
+    converted.components[2] = (real)src0.components[2];
+    converted.components[3] = (real)src0.components[3];
+    return converted;
+}
+
+/* Per-component reinterpretation of an ivec4 as a uvec4 (two's complement). */
+static uvec4 uvec4_from_ivec4(ivec4 src0)
+{
+    uvec4 converted;
+    converted.components[0] = (u32)src0.components[0];
+    converted.components[1] = (u32)src0.components[1];
+    converted.components[2] = (u32)src0.components[2];
+    converted.components[3] = (u32)src0.components[3];
+    return converted;
+}
+
+/* Expands a MASK_* bitmask into per-component lane masks (all ones or all zeros), for *_select. */
+static uvec4 uvec4_from_mask(u32 mask)
+{
+    uvec4 lanes;
+    lanes.components[0] = 0u - ((mask >> _0) & 1u);
+    lanes.components[1] = 0u - ((mask >> _1) & 1u);
+    lanes.components[2] = 0u - ((mask >> _2) & 1u);
+    lanes.components[3] = 0u - ((mask >> _3) & 1u);
+    return lanes;
+}
+
+/* Collapses per-component lane masks back into a MASK_* bitmask (top bit of each component). */
+static u32 uvec4_movemask(uvec4 lanes)
+{
+    u32 mask = (
+        ((lanes.components[0] >> 31) << _0) |
+        ((lanes.components[1] >> 31) << _1) |
+        ((lanes.components[2] >> 31) << _2) |
+        ((lanes.components[3] >> 31) << _3));
+    return mask;
+}
+
+/* -------------------------------------------------------------------------
+   3x3 matrix operations
+   ------------------------------------------------------------------------- */
+
+/* Construct a mat3 from a quaternion. */
+static mat3 mat3_from_quat(vec4 q)
+{
+    real xx = q.position.x * q.position.x;
+    real yy = q.position.y * q.position.y;
+    real zz = q.position.z * q.position.z;
+    real xy = q.position.x * q.position.y;
+    real xz = q.position.x * q.position.z;
+    real yz = q.position.y * q.position.z;
+    real wx = q.rotation.w * q.position.x;
+    real wy = q.rotation.w * q.position.y;
+    real wz = q.rotation.w * q.position.z;
+    mat3 m;
+    m.data[0] = 1.0f - 2.0f * (yy + zz);
+    m.data[1] = 2.0f * (xy - wz);
+    m.data[2] = 2.0f * (xz + wy);
+    m.data[3] = 2.0f * (xy + wz);
+    m.data[4] = 1.0f - 2.0f * (xx + zz);
+    m.data[5] = 2.0f * (yz - wx);
+    m.data[6] = 2.0f * (xz - wy);
+    m.data[7] = 2.0f * (yz + wx);
+    m.data[8] = 1.0f - 2.0f * (xx + yy);
+    return m;
+}
+
+/* Transpose a mat3 (swap rows and columns). */
+static mat3 mat3_transpose(mat3 m)
+{
+    mat3 t;
+    t.data[0] = m.data[0];
+    t.data[1] = m.data[3];
+    t.data[2] = m.data[6];
+    t.data[3] = m.data[1];
+    t.data[4] = m.data[4];
+    t.data[5] = m.data[7];
+    t.data[6] = m.data[2];
+    t.data[7] = m.data[5];
+    t.data[8] = m.data[8];
+    return t;
+}
+
+/* Multiply two mat3 matrices. */
+static mat3 mat3_mul(mat3 a, mat3 b)
+{
+    mat3 r;
+    i32 i, j, k;
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            real sum = 0;
+            for (k = 0; k < 3; k++)
+            {
+                sum += a.data[i * 3 + k] * b.data[k * 3 + j];
+            }
+            r.data[i * 3 + j] = sum;
+        }
+    }
+    return r;
+}
+
+/* Multiply a mat3 by a vec3. */
+static vec3 mat3_mul_vec3(mat3 m, vec3 v)
+{
+    vec3 result;
+    result.position.x = m.data[0] * v.position.x + m.data[1] * v.position.y + m.data[2] * v.position.z;
+    result.position.y = m.data[3] * v.position.x + m.data[4] * v.position.y + m.data[5] * v.position.z;
+    result.position.z = m.data[6] * v.position.x + m.data[7] * v.position.y + m.data[8] * v.position.z;
     return result;
 }
 
-/* Create a perspective projection mat4. */
-static mat4 mat4_perspective(real fov_y, real aspect, real near_plane, real far_plane)
+/* Inverse of a diagonal 3x3 matrix.
+   Assumes data[1],data[2],data[3],data[5],data[6],data[7] are zero.
+   Returns a mat3 with reciprocals on the diagonal (or zero where original is zero). */
+static mat3 mat3_inverse_diagonal(mat3 m) {
+    mat3 r;
+    r.data[0] = m.data[0] != 0.0f ? 1.0f / m.data[0] : 0.0f;
+    r.data[1] = 0.0f; r.data[2] = 0.0f;
+    r.data[3] = 0.0f;
+    r.data[4] = m.data[4] != 0.0f ? 1.0f / m.data[4] : 0.0f;
+    r.data[5] = 0.0f;
+    r.data[6] = 0.0f; r.data[7] = 0.0f;
+    r.data[8] = m.data[8] != 0.0f ? 1.0f / m.data[8] : 0.0f;
+    return r;
+}
+
+/* Eigen decomposition of a symmetric mat3 by cyclic Jacobi rotations.
+   Writes the eigenvalues in decreasing order and the matching unit eigenvectors (3 entries). */
+static void mat3_eigen_symmetric(mat3 m, vec3 *eigenvalues, vec3 *eigenvectors)
+{
+    static const i32 pairs[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+    real a[3][3], v[3][3];
+    i32 sweep, pair, r, i, j;
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            a[i][j] = m.data[i * 3 + j];
+            v[i][j] = i == j ? 1.0f : 0.0f;
+        }
+    }
+    for (sweep = 0; sweep < 32; sweep++)
+    {
+        real off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        real diagonal = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (off <= 1e-14f * diagonal || off == 0.0f)
+        {
+            break;
+        }
+        for (pair = 0; pair < 3; pair++)
+        {
+            i32 p = pairs[pair][0], q = pairs[pair][1];
+            real apq = a[p][q];
+            real theta, t, c, s;
+            if (apq == 0.0f)
+            {
+                continue;
+            }
+            /* Rotation angle that zeroes a[p][q]; t = tan(angle), smaller root for stability. */
+            theta = (a[q][q] - a[p][p]) / (2.0f * apq);
+            t = (theta >= 0.0f ? 1.0f : -1.0f) / (real_abs(theta) + real_sqrt(theta * theta + 1.0f));
+            c = 1.0f / real_sqrt(t * t + 1.0f);
+            s = t * c;
+            a[p][p] -= t * apq;
+            a[q][q] += t * apq;
+            a[p][q] = 0.0f;
+            a[q][p] = 0.0f;
+            for (r = 0; r < 3; r++)
+            {
+                real vrp = v[r][p], vrq = v[r][q];
+                v[r][p] = c * vrp - s * vrq;
+                v[r][q] = s * vrp + c * vrq;
+                if (r != p && r != q)
+                {
+                    real arp = a[r][p], arq = a[r][q];
+                    a[r][p] = c * arp - s * arq;
+                    a[p][r] = a[r][p];
+                    a[r][q] = s * arp + c * arq;
+                    a[q][r] = a[r][q];
+                }
+            }
+        }
+    }
+    /* Sort by decreasing eigenvalue; eigenvector k is column k of v. */
+    {
+        i32 order[3] = { 0, 1, 2 };
+        for (i = 0; i < 2; i++)
+        {
+            for (j = i + 1; j < 3; j++)
+            {
+                if (a[order[j]][order[j]] > a[order[i]][order[i]])
+                {
+                    i32 swap = order[i];
+                    order[i] = order[j];
+                    order[j] = swap;
+                }
+            }
+        }
+        for (i = 0; i < 3; i++)
+        {
+            eigenvalues->components[i] = a[order[i]][order[i]];
+            eigenvectors[i] = vec3_init_from_3(v[0][order[i]], v[1][order[i]], v[2][order[i]]);
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------
+   4x4 matrix operations
+   ------------------------------------------------------------------------- */
+
+/* Create an identity mat4 (1's on diagonal, 0's elsewhere). */
+static mat4 mat4_identity(void)
 {
     mat4 r;
-    real tan_half_fov;
-    i32 i, j;
+    i32 i;
+    for (i = 0; i < 16; i++)
+    {
+        r.data[i] = 0;
+    }
+    r.transpose[0][0] = 1;
+    r.transpose[1][1] = 1;
+    r.transpose[2][2] = 1;
+    r.transpose[3][3] = 1;
+    return r;
+}
+
+/* Multiply two mat4 matrices. */
+static mat4 mat4_mul(mat4 a, mat4 b)
+{
+    mat4 r;
+    i32 i, j, k;
     for (i = 0; i < 4; i++)
     {
         for (j = 0; j < 4; j++)
         {
             r.transpose[i][j] = 0;
+            for (k = 0; k < 4; k++)
+            {
+                r.transpose[i][j] = real_fma(a.transpose[i][k], b.transpose[k][j], r.transpose[i][j]);
+            }
         }
     }
+    return r;
+}
+
+/* Multiply a mat4 by a vec4. */
+static vec4 mat4_mul_vec4(mat4 m, vec4 v)
+{
+    vec4 result;
+    result.position.x = m.transpose[0][0] * v.position.x;
+    result.position.x = real_fma(m.transpose[0][1], v.position.y, result.position.x);
+    result.position.x = real_fma(m.transpose[0][2], v.position.z, result.position.x);
+    result.position.x = real_fma(m.transpose[0][3], v.rotation.w, result.position.x);
+    result.position.y = m.transpose[1][0] * v.position.x;
+    result.position.y = real_fma(m.transpose[1][1], v.position.y, result.position.y);
+    result.position.y = real_fma(m.transpose[1][2], v.position.z, result.position.y);
+    result.position.y = real_fma(m.transpose[1][3], v.rotation.w, result.position.y);
+    result.position.z = m.transpose[2][0] * v.position.x;
+    result.position.z = real_fma(m.transpose[2][1], v.position.y, result.position.z);
+    result.position.z = real_fma(m.transpose[2][2], v.position.z, result.position.z);
+    result.position.z = real_fma(m.transpose[2][3], v.rotation.w, result.position.z);
+    result.rotation.w = m.transpose[3][0] * v.position.x;
+    result.rotation.w = real_fma(m.transpose[3][1], v.position.y, result.rotation.w);
+    result.rotation.w = real_fma(m.transpose[3][2], v.position.z, result.rotation.w);
+    result.rotation.w = real_fma(m.transpose[3][3], v.rotation.w, result.rotation.w);
+    return result;
+}
+
+/* Create a mat4 with every element set to zero. */
+static mat4 mat4_zero(void)
+{
+    mat4 r;
+    i32 i;
+    for (i = 0; i < 16; i++)
+    {
+        r.data[i] = 0;
+    }
+    return r;
+}
+
+/* Create a perspective projection mat4. */
+static mat4 mat4_perspective(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    mat4 r = mat4_zero();
+    real tan_half_fov;
     tan_half_fov = real_tan(fov_y * 0.5f);
     r.transpose[0][0] = 1.0f / (aspect * tan_half_fov);
     r.transpose[1][1] = 1.0f / tan_half_fov;
@@ -2260,6 +4694,117 @@ static mat4 mat4_perspective(real fov_y, real aspect, real near_plane, real far_
     return r;
 }
 
+/* Create a perspective projection mat4 with 0..1 clip depth (Vulkan/D3D). */
+static mat4 mat4_perspective_zo(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    mat4 r = mat4_zero();
+    real tan_half_fov = real_tan(fov_y * 0.5f);
+    r.transpose[0][0] = 1.0f / (aspect * tan_half_fov);
+    r.transpose[1][1] = 1.0f / tan_half_fov;
+    r.transpose[2][2] = far_plane / (near_plane - far_plane);
+    r.transpose[2][3] = (far_plane * near_plane) / (near_plane - far_plane);
+    r.transpose[3][2] = -1.0f;
+    return r;
+}
+
+/* Create a perspective projection mat4 with the far plane at infinity (-1..1 clip depth). */
+static mat4 mat4_perspective_infinite(real fov_y, real aspect, real near_plane)
+{
+    mat4 r = mat4_zero();
+    real tan_half_fov = real_tan(fov_y * 0.5f);
+    r.transpose[0][0] = 1.0f / (aspect * tan_half_fov);
+    r.transpose[1][1] = 1.0f / tan_half_fov;
+    r.transpose[2][2] = -1.0f;
+    r.transpose[2][3] = -2.0f * near_plane;
+    r.transpose[3][2] = -1.0f;
+    return r;
+}
+
+/* Create a reversed-Z perspective projection mat4 (near maps to depth 1, far maps to depth 0).
+   Spreads floating-point depth precision evenly over distance when paired with a 0..1 depth buffer. */
+static mat4 mat4_perspective_reversed_zo(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    mat4 r = mat4_zero();
+    real tan_half_fov = real_tan(fov_y * 0.5f);
+    r.transpose[0][0] = 1.0f / (aspect * tan_half_fov);
+    r.transpose[1][1] = 1.0f / tan_half_fov;
+    r.transpose[2][2] = near_plane / (far_plane - near_plane);
+    r.transpose[2][3] = (far_plane * near_plane) / (far_plane - near_plane);
+    r.transpose[3][2] = -1.0f;
+    return r;
+}
+
+/* Create a reversed-Z perspective projection mat4 with the far plane at infinity.
+   Depth is simply near_plane / -z, reaching 0 only at infinite distance. */
+static mat4 mat4_perspective_reversed_infinite_zo(real fov_y, real aspect, real near_plane)
+{
+    mat4 r = mat4_zero();
+    real tan_half_fov = real_tan(fov_y * 0.5f);
+    r.transpose[0][0] = 1.0f / (aspect * tan_half_fov);
+    r.transpose[1][1] = 1.0f / tan_half_fov;
+    r.transpose[2][3] = near_plane;
+    r.transpose[3][2] = -1.0f;
+    return r;
+}
+
+/* Create an orthographic projection mat4 (-1..1 clip depth). */
+static mat4 mat4_orthographic(real left, real right, real bottom, real top, real near_plane, real far_plane)
+{
+    mat4 r = mat4_zero();
+    r.transpose[0][0] = 2.0f / (right - left);
+    r.transpose[1][1] = 2.0f / (top - bottom);
+    r.transpose[2][2] = -2.0f / (far_plane - near_plane);
+    r.transpose[0][3] = -(right + left) / (right - left);
+    r.transpose[1][3] = -(top + bottom) / (top - bottom);
+    r.transpose[2][3] = -(far_plane + near_plane) / (far_plane - near_plane);
+    r.transpose[3][3] = 1.0f;
+    return r;
+}
+
+/* Create an orthographic projection mat4 with 0..1 clip depth (Vulkan/D3D). */
+static mat4 mat4_orthographic_zo(real left, real right, real bottom, real top, real near_plane, real far_plane)
+{
+    mat4 r = mat4_zero();
+    r.transpose[0][0] = 2.0f / (right - left);
+    r.transpose[1][1] = 2.0f / (top - bottom);
+    r.transpose[2][2] = -1.0f / (far_plane - near_plane);
+    r.transpose[0][3] = -(right + left) / (right - left);
+    r.transpose[1][3] = -(top + bottom) / (top - bottom);
+    r.transpose[2][3] = -near_plane / (far_plane - near_plane);
+    r.transpose[3][3] = 1.0f;
+    return r;
+}
+
+/* Closed-form inverse of any mat4 produced by the mat4_perspective* builders.
+   Only reads the five non-zero terms, so it is far cheaper than a general 4x4 inverse. */
+static mat4 mat4_inverse_perspective(mat4 m)
+{
+    mat4 r = mat4_zero();
+    real c = m.transpose[2][2];
+    real d = m.transpose[2][3];
+    real e = m.transpose[3][2];
+    r.transpose[0][0] = 1.0f / m.transpose[0][0];
+    r.transpose[1][1] = 1.0f / m.transpose[1][1];
+    r.transpose[2][3] = 1.0f / e;
+    r.transpose[3][2] = 1.0f / d;
+    r.transpose[3][3] = -c / (d * e);
+    return r;
+}
+
+/* Closed-form inverse of any mat4 produced by the mat4_orthographic* builders. */
+static mat4 mat4_inverse_orthographic(mat4 m)
+{
+    mat4 r = mat4_zero();
+    r.transpose[0][0] = 1.0f / m.transpose[0][0];
+    r.transpose[1][1] = 1.0f / m.transpose[1][1];
+    r.transpose[2][2] = 1.0f / m.transpose[2][2];
+    r.transpose[0][3] = -m.transpose[0][3] / m.transpose[0][0];
+    r.transpose[1][3] = -m.transpose[1][3] / m.transpose[1][1];
+    r.transpose[2][3] = -m.transpose[2][3] / m.transpose[2][2];
+    r.transpose[3][3] = 1.0f;
+    return r;
+}
+
 /* Create a view matrix looking at a target. */
 static mat4 mat4_lookat(vec3 eye, vec3 center, vec3 up) {
     vec3 forward, side, up_cross;
@@ -2301,6 +4846,266 @@ static mat4 mat4_lookat(vec3 eye, vec3 center, vec3 up) {
     return r;
 }
 
+/* -------------------------------------------------------------------------
+   Projections - a projection mat4 paired with its cached closed-form inverse
+   ------------------------------------------------------------------------- */
+
+typedef struct projection
+{
+    mat4 matrix;
+    mat4 inverse;
+} projection;
+
+/* Perspective projection (-1..1 clip depth) with cached inverse. */
+static projection projection_perspective(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    projection p;
+    p.matrix = mat4_perspective(fov_y, aspect, near_plane, far_plane);
+    p.inverse = mat4_inverse_perspective(p.matrix);
+    return p;
+}
+
+/* Perspective projection (0..1 clip depth) with cached inverse. */
+static projection projection_perspective_zo(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    projection p;
+    p.matrix = mat4_perspective_zo(fov_y, aspect, near_plane, far_plane);
+    p.inverse = mat4_inverse_perspective(p.matrix);
+    return p;
+}
+
+/* Infinite-far perspective projection (-1..1 clip depth) with cached inverse. */
+static projection projection_perspective_infinite(real fov_y, real aspect, real near_plane)
+{
+    projection p;
+    p.matrix = mat4_perspective_infinite(fov_y, aspect, near_plane);
+    p.inverse = mat4_inverse_perspective(p.matrix);
+    return p;
+}
+
+/* Reversed-Z perspective projection (0..1 clip depth) with cached inverse. */
+static projection projection_perspective_reversed_zo(real fov_y, real aspect, real near_plane, real far_plane)
+{
+    projection p;
+    p.matrix = mat4_perspective_reversed_zo(fov_y, aspect, near_plane, far_plane);
+    p.inverse = mat4_inverse_perspective(p.matrix);
+    return p;
+}
+
+/* Reversed-Z infinite-far perspective projection (0..1 clip depth) with cached inverse. */
+static projection projection_perspective_reversed_infinite_zo(real fov_y, real aspect, real near_plane)
+{
+    projection p;
+    p.matrix = mat4_perspective_reversed_infinite_zo(fov_y, aspect, near_plane);
+    p.inverse = mat4_inverse_perspective(p.matrix);
+    return p;
+}
+
+/* Orthographic projection (-1..1 clip depth) with cached inverse. */
+static projection projection_orthographic(real left, real right, real bottom, real top, real near_plane, real far_plane)
+{
+    projection p;
+    p.matrix = mat4_orthographic(left, right, bottom, top, near_plane, far_plane);
+    p.inverse = mat4_inverse_orthographic(p.matrix);
+    return p;
+}
+
+/* Orthographic projection (0..1 clip depth) with cached inverse. */
+static projection projection_orthographic_zo(real left, real right, real bottom, real top, real near_plane, real far_plane)
+{
+    projection p;
+    p.matrix = mat4_orthographic_zo(left, right, bottom, top, near_plane, far_plane);
+    p.inverse = mat4_inverse_orthographic(p.matrix);
+    return p;
+}
+
+/* Transform a view-space point into normalized device coordinates (includes the perspective divide). */
+static vec3 projection_project(projection p, vec3 view_point)
+{
+    vec4 clip = mat4_mul_vec4(p.matrix, vec4_init_from_4(view_point.position.x, view_point.position.y, view_point.position.z, 1.0f));
+    return vec3_div_scalar(clip.vec3, clip.rotation.w);
+}
+
+/* Transform a normalized device coordinate back into a view-space point using the cached inverse. */
+static vec3 projection_unproject(projection p, vec3 ndc)
+{
+    vec4 view = mat4_mul_vec4(p.inverse, vec4_init_from_4(ndc.position.x, ndc.position.y, ndc.position.z, 1.0f));
+    return vec3_div_scalar(view.vec3, view.rotation.w);
+}
+
+/* -------------------------------------------------------------------------
+   Bulk transforms - array kernels with the matrix hoisted into locals so the
+   loops stay branch-free and auto-vectorize across 4/8 points.
+   Screen space is (x, y) in viewport pixels with y up, z is the NDC depth of
+   the projection in use (0..1 for the *_zo builders, -1..1 otherwise).
+   `viewport` is (x, y, width, height).
+   ------------------------------------------------------------------------- */
+
+/* Multiply `count` vec4 by a mat4 (dst may alias src). */
+static void mat4_mul_vec4_array(mat4 m, const vec4 *src, vec4 *dst, u32 count)
+{
+    real m00 = m.transpose[0][0], m01 = m.transpose[0][1], m02 = m.transpose[0][2], m03 = m.transpose[0][3];
+    real m10 = m.transpose[1][0], m11 = m.transpose[1][1], m12 = m.transpose[1][2], m13 = m.transpose[1][3];
+    real m20 = m.transpose[2][0], m21 = m.transpose[2][1], m22 = m.transpose[2][2], m23 = m.transpose[2][3];
+    real m30 = m.transpose[3][0], m31 = m.transpose[3][1], m32 = m.transpose[3][2], m33 = m.transpose[3][3];
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        real x = src[i].components[0];
+        real y = src[i].components[1];
+        real z = src[i].components[2];
+        real w = src[i].components[3];
+        dst[i].components[0] = m00 * x + m01 * y + m02 * z + m03 * w;
+        dst[i].components[1] = m10 * x + m11 * y + m12 * z + m13 * w;
+        dst[i].components[2] = m20 * x + m21 * y + m22 * z + m23 * w;
+        dst[i].components[3] = m30 * x + m31 * y + m32 * z + m33 * w;
+    }
+}
+
+/* Project `count` world-space points through a view-projection mat4 into screen space (dst may alias src). */
+static void mat4_project_vec3_array(mat4 view_projection, vec4 viewport, const vec3 *points, vec3 *screen, u32 count)
+{
+    real m00 = view_projection.transpose[0][0], m01 = view_projection.transpose[0][1], m02 = view_projection.transpose[0][2], m03 = view_projection.transpose[0][3];
+    real m10 = view_projection.transpose[1][0], m11 = view_projection.transpose[1][1], m12 = view_projection.transpose[1][2], m13 = view_projection.transpose[1][3];
+    real m20 = view_projection.transpose[2][0], m21 = view_projection.transpose[2][1], m22 = view_projection.transpose[2][2], m23 = view_projection.transpose[2][3];
+    real m30 = view_projection.transpose[3][0], m31 = view_projection.transpose[3][1], m32 = view_projection.transpose[3][2], m33 = view_projection.transpose[3][3];
+    real half_width = viewport.components[2] * 0.5f;
+    real half_height = viewport.components[3] * 0.5f;
+    real center_x = viewport.components[0] + half_width;
+    real center_y = viewport.components[1] + half_height;
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        real x = points[i].components[0];
+        real y = points[i].components[1];
+        real z = points[i].components[2];
+        real clip_x = m00 * x + m01 * y + m02 * z + m03;
+        real clip_y = m10 * x + m11 * y + m12 * z + m13;
+        real clip_z = m20 * x + m21 * y + m22 * z + m23;
+        real rcp_w = 1.0f / (m30 * x + m31 * y + m32 * z + m33);
+        screen[i].components[0] = center_x + (clip_x * rcp_w) * half_width;
+        screen[i].components[1] = center_y + (clip_y * rcp_w) * half_height;
+        screen[i].components[2] = clip_z * rcp_w;
+    }
+}
+
+/* Unproject `count` screen-space points back into world space.
+   Pass the inverse of the view-projection (e.g. mat4_mul(view_inverse, projection.inverse)). */
+static void mat4_unproject_vec3_array(mat4 inverse_view_projection, vec4 viewport, const vec3 *screen, vec3 *points, u32 count)
+{
+    real m00 = inverse_view_projection.transpose[0][0], m01 = inverse_view_projection.transpose[0][1], m02 = inverse_view_projection.transpose[0][2], m03 = inverse_view_projection.transpose[0][3];
+    real m10 = inverse_view_projection.transpose[1][0], m11 = inverse_view_projection.transpose[1][1], m12 = inverse_view_projection.transpose[1][2], m13 = inverse_view_projection.transpose[1][3];
+    real m20 = inverse_view_projection.transpose[2][0], m21 = inverse_view_projection.transpose[2][1], m22 = inverse_view_projection.transpose[2][2], m23 = inverse_view_projection.transpose[2][3];
+    real m30 = inverse_view_projection.transpose[3][0], m31 = inverse_view_projection.transpose[3][1], m32 = inverse_view_projection.transpose[3][2], m33 = inverse_view_projection.transpose[3][3];
+    real scale_x = 2.0f / viewport.components[2];
+    real scale_y = 2.0f / viewport.components[3];
+    real offset_x = -1.0f - viewport.components[0] * scale_x;
+    real offset_y = -1.0f - viewport.components[1] * scale_y;
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        real x = screen[i].components[0] * scale_x + offset_x;
+        real y = screen[i].components[1] * scale_y + offset_y;
+        real z = screen[i].components[2];
+        real world_x = m00 * x + m01 * y + m02 * z + m03;
+        real world_y = m10 * x + m11 * y + m12 * z + m13;
+        real world_z = m20 * x + m21 * y + m22 * z + m23;
+        real rcp_w = 1.0f / (m30 * x + m31 * y + m32 * z + m33);
+        points[i].components[0] = world_x * rcp_w;
+        points[i].components[1] = world_y * rcp_w;
+        points[i].components[2] = world_z * rcp_w;
+    }
+}
+
+/* Unproject every sample of a width x height depth buffer (row 0 at the bottom, NDC depth values)
+   into world-space positions sampled at pixel centres. The row and column terms are hoisted, so each
+   sample costs one depth multiply-add per output plus a single reciprocal. */
+static void mat4_unproject_depth_buffer(mat4 inverse_view_projection, const real *depth, vec3 *points, u32 width, u32 height)
+{
+    real m00 = inverse_view_projection.transpose[0][0], m01 = inverse_view_projection.transpose[0][1], m02 = inverse_view_projection.transpose[0][2], m03 = inverse_view_projection.transpose[0][3];
+    real m10 = inverse_view_projection.transpose[1][0], m11 = inverse_view_projection.transpose[1][1], m12 = inverse_view_projection.transpose[1][2], m13 = inverse_view_projection.transpose[1][3];
+    real m20 = inverse_view_projection.transpose[2][0], m21 = inverse_view_projection.transpose[2][1], m22 = inverse_view_projection.transpose[2][2], m23 = inverse_view_projection.transpose[2][3];
+    real m30 = inverse_view_projection.transpose[3][0], m31 = inverse_view_projection.transpose[3][1], m32 = inverse_view_projection.transpose[3][2], m33 = inverse_view_projection.transpose[3][3];
+    real step_x = 2.0f / (real)width;
+    real step_y = 2.0f / (real)height;
+    u32 row, column;
+    for (row = 0; row < height; row++)
+    {
+        real y = ((real)row + 0.5f) * step_y - 1.0f;
+        real row_x = m01 * y + m03;
+        real row_y = m11 * y + m13;
+        real row_z = m21 * y + m23;
+        real row_w = m31 * y + m33;
+        const real *depth_row = depth + (u64)row * width;
+        vec3 *point_row = points + (u64)row * width;
+        for (column = 0; column < width; column++)
+        {
+            real x = ((real)column + 0.5f) * step_x - 1.0f;
+            real z = depth_row[column];
+            real rcp_w = 1.0f / (row_w + m30 * x + m32 * z);
+            point_row[column].components[0] = (row_x + m00 * x + m02 * z) * rcp_w;
+            point_row[column].components[1] = (row_y + m10 * x + m12 * z) * rcp_w;
+            point_row[column].components[2] = (row_z + m20 * x + m22 * z) * rcp_w;
+        }
+    }
+}
+
+/* Transform `count` points by a mat4 as (x, y, z, 1), keeping xyz with no perspective divide (dst may alias src). */
+static void mat4_transform_vec3_array(mat4 m, const vec3 *src, vec3 *dst, u32 count)
+{
+    real m00 = m.transpose[0][0], m01 = m.transpose[0][1], m02 = m.transpose[0][2], m03 = m.transpose[0][3];
+    real m10 = m.transpose[1][0], m11 = m.transpose[1][1], m12 = m.transpose[1][2], m13 = m.transpose[1][3];
+    real m20 = m.transpose[2][0], m21 = m.transpose[2][1], m22 = m.transpose[2][2], m23 = m.transpose[2][3];
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        real x = src[i].components[0];
+        real y = src[i].components[1];
+        real z = src[i].components[2];
+        dst[i].components[0] = m00 * x + m01 * y + m02 * z + m03;
+        dst[i].components[1] = m10 * x + m11 * y + m12 * z + m13;
+        dst[i].components[2] = m20 * x + m21 * y + m22 * z + m23;
+    }
+}
+
+/* Normalize `count` vec3 (dst may alias src). Like vec3_normalize, zero-length input is not guarded. */
+static void vec3_normalize_array(const vec3 *src, vec3 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        real x = src[i].components[0];
+        real y = src[i].components[1];
+        real z = src[i].components[2];
+        real rcp_magnitude = 1.0f / real_sqrt(x * x + y * y + z * z);
+        dst[i].components[0] = x * rcp_magnitude;
+        dst[i].components[1] = y * rcp_magnitude;
+        dst[i].components[2] = z * rcp_magnitude;
+    }
+}
+
+/* Axis-aligned bounds of `count` points (count must be non-zero). */
+static void vec3_aabb_array(const vec3 *points, u32 count, vec3 *minimum, vec3 *maximum)
+{
+    real min_x = points[0].components[0], min_y = points[0].components[1], min_z = points[0].components[2];
+    real max_x = min_x, max_y = min_y, max_z = min_z;
+    u32 i;
+    for (i = 1; i < count; i++)
+    {
+        real x = points[i].components[0];
+        real y = points[i].components[1];
+        real z = points[i].components[2];
+        min_x = x < min_x ? x : min_x;
+        min_y = y < min_y ? y : min_y;
+        min_z = z < min_z ? z : min_z;
+        max_x = x > max_x ? x : max_x;
+        max_y = y > max_y ? y : max_y;
+        max_z = z > max_z ? z : max_z;
+    }
+    *minimum = vec3_init_from_3(min_x, min_y, min_z);
+    *maximum = vec3_init_from_3(max_x, max_y, max_z);
+}
+
 /* Identity quaternion representing no rotation. */
 static vec4 quat_identity(void)
 {
@@ -2326,10 +5131,22 @@ static vec4 quat_inverse(vec4 src0)
 static vec4 quat_mul(vec4 multiplicand, vec4 multiplier)
 {
     vec4 product;
-    product.rotation.i = (multiplicand.rotation.w * multiplier.rotation.i) + (multiplicand.rotation.i * multiplier.rotation.w) + (multiplicand.rotation.j * multiplier.rotation.k) - (multiplicand.rotation.k * multiplier.rotation.j);
-    product.rotation.j = (multiplicand.rotation.w * multiplier.rotation.j) - (multiplicand.rotation.i * multiplier.rotation.k) + (multiplicand.rotation.j * multiplier.rotation.w) + (multiplicand.rotation.k * multiplier.rotation.i);
-    product.rotation.k = (multiplicand.rotation.w * multiplier.rotation.k) + (multiplicand.rotation.i * multiplier.rotation.j) - (multiplicand.rotation.j * multiplier.rotation.i) + (multiplicand.rotation.k * multiplier.rotation.w);
-    product.rotation.w = (multiplicand.rotation.w * multiplier.rotation.w) - (multiplicand.rotation.i * multiplier.rotation.i) - (multiplicand.rotation.j * multiplier.rotation.j) - (multiplicand.rotation.k * multiplier.rotation.k);
+    product.rotation.i = (multiplicand.rotation.w * multiplier.rotation.i);
+    product.rotation.i = real_fma(multiplicand.rotation.i, multiplier.rotation.w, product.rotation.i);
+    product.rotation.i = real_fma(multiplicand.rotation.j, multiplier.rotation.k, product.rotation.i);
+    product.rotation.i = real_fma(-multiplicand.rotation.k, multiplier.rotation.j, product.rotation.i);
+    product.rotation.j = (multiplicand.rotation.w * multiplier.rotation.j);
+    product.rotation.j = real_fma(-multiplicand.rotation.i, multiplier.rotation.k, product.rotation.j);
+    product.rotation.j = real_fma(multiplicand.rotation.j, multiplier.rotation.w, product.rotation.j);
+    product.rotation.j = real_fma(multiplicand.rotation.k, multiplier.rotation.i, product.rotation.j);
+    product.rotation.k = (multiplicand.rotation.w * multiplier.rotation.k);
+    product.rotation.k = real_fma(multiplicand.rotation.i, multiplier.rotation.j, product.rotation.k);
+    product.rotation.k = real_fma(-multiplicand.rotation.j, multiplier.rotation.i, product.rotation.k);
+    product.rotation.k = real_fma(multiplicand.rotation.k, multiplier.rotation.w, product.rotation.k);
+    product.rotation.w = (multiplicand.rotation.w * multiplier.rotation.w);
+    product.rotation.w = real_fma(-multiplicand.rotation.i, multiplier.rotation.i, product.rotation.w);
+    product.rotation.w = real_fma(-multiplicand.rotation.j, multiplier.rotation.j, product.rotation.w);
+    product.rotation.w = real_fma(-multiplicand.rotation.k, multiplier.rotation.k, product.rotation.w);
     return product;
 }
 
@@ -2446,6 +5263,16 @@ static vec4 quat_slerp(vec4 src0, vec4 src1, real factor)
     return vec4_add(vec4_mul_scalar(src0, scale0), vec4_mul_scalar(end, scale1));
 }
 
+/* Spherical linear interpolation of `count` quaternion pairs by one factor (dst may alias either source). */
+static void quat_slerp_array(const vec4 *src0, const vec4 *src1, real factor, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = quat_slerp(src0[i], src1[i], factor);
+    }
+}
+
 /* Rotate a vec3 by a quaternion. */
 static vec3 quat_rotate_vec3(vec4 rotation, vec3 vector)
 {
@@ -2466,6 +5293,41 @@ static vec4 quat_rotate_vec4(vec4 rotation, vec4 vector)
     return rotated;
 }
 
+/* Time derivative of an orientation spinning at a world-space angular velocity: 0.5 * (w, 0) * q. */
+static vec4 quat_derivative(vec4 rotation, vec3 angular_velocity)
+{
+    vec4 spin = vec4_init_from_4(angular_velocity.rotation.i, angular_velocity.rotation.j, angular_velocity.rotation.k, 0.0f);
+    vec4 derivative = vec4_mul_scalar(quat_mul(spin, rotation), 0.5f);
+    return derivative;
+}
+
+/* Advance an orientation by a world-space angular velocity over `dt` seconds, renormalized. */
+static vec4 quat_integrate(vec4 rotation, vec3 angular_velocity, real dt)
+{
+    vec4 derivative = quat_derivative(rotation, angular_velocity);
+    vec4 advanced = vec4_fma(derivative, vec4_init_from_1(dt), rotation);
+    return vec4_normalize(advanced);
+}
+
+/* Logarithm of a unit quaternion: (axis * half_angle, 0). */
+static vec4 quat_log(vec4 rotation)
+{
+    real w = real_min(real_max(rotation.rotation.w, -1.0f), 1.0f);
+    real half_angle = real_acos(w);
+    real sin_half = real_sin(half_angle);
+    real scale = sin_half > VECTORS_QUAT_EPSILON ? half_angle / sin_half : 1.0f;
+    return vec4_init_from_4(rotation.rotation.i * scale, rotation.rotation.j * scale, rotation.rotation.k * scale, 0.0f);
+}
+
+/* Exponential of a pure quaternion (v, 0): (sin|v| * v / |v|, cos|v|). Inverse of quat_log. */
+static vec4 quat_exp(vec4 logarithm)
+{
+    real half_angle = vec3_magnitude(logarithm.vec3);
+    real sin_half = real_sin(half_angle);
+    real scale = half_angle > VECTORS_QUAT_EPSILON ? sin_half / half_angle : 1.0f;
+    return vec4_init_from_4(logarithm.rotation.i * scale, logarithm.rotation.j * scale, logarithm.rotation.k * scale, real_cos(half_angle));
+}
+
 /* Undefine internal helper macros */
 #undef CONCAT_
 #undef CONCAT
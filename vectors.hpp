@@ -0,0 +1,1170 @@
+#if !defined(VECTORS_HPP)
+#define VECTORS_HPP
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+   Optional C++ layer (C++11 or later).
+
+   Vec2/Vec3/Vec4, Mat4 and Quat wrap the C unions and convert to and from
+   them implicitly, so both APIs can be mixed freely.
+
+   Vector arithmetic builds expression templates: nothing is computed until
+   the expression is assigned to a Vec (or a Span, for whole arrays), at which
+   point every component is evaluated once in a single pass. That means
+       Vec3 r = a * s + cross(b, c);
+   produces no temporary vectors and compiles to a multiply-add chain per
+   component (FMA when the target has it and contraction is enabled).
+
+   Expressions keep references to the vectors they read, so assign them
+   before those vectors go out of scope - never hold one in an `auto`.
+
+   From C++14 on, construction and arithmetic of Vec, Mat4 and Quat are
+   constexpr, and vectors::cx provides constexpr trig and camera builders,
+   so fixed transforms and tables can be baked at compile time:
+       constexpr Mat4 projection = cx::perspective(cx::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+   ------------------------------------------------------------------------- */
+
+/* constexpr needs the relaxed rules of C++14 (loops and local variables). */
+#if (__cplusplus >= 201402L) || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+    #define VECTORS_CONSTEXPR constexpr
+#else
+    #define VECTORS_CONSTEXPR inline
+#endif
+
+/* SIMD specializations of the generic VecN/MatMxN kernels (define VECTORS_NO_SIMD to disable). */
+#if !defined(VECTORS_NO_SIMD)
+    #if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #define VECTORS_HPP_SSE 1
+        #include <xmmintrin.h>
+    #endif
+    #if defined(__AVX__)
+        #define VECTORS_HPP_AVX 1
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace vectors
+{
+
+template <unsigned Size> class Vec;
+
+namespace detail
+{
+    /* The C union backing a vector of each size. */
+    template <unsigned Size> struct c_vector;
+    template <> struct c_vector<2> { typedef vec2 type; };
+    template <> struct c_vector<3> { typedef vec3 type; };
+    template <> struct c_vector<4> { typedef vec4 type; };
+
+    struct op_add { static VECTORS_CONSTEXPR real apply(real a, real b) { return a + b; } };
+    struct op_sub { static VECTORS_CONSTEXPR real apply(real a, real b) { return a - b; } };
+    struct op_mul { static VECTORS_CONSTEXPR real apply(real a, real b) { return a * b; } };
+    struct op_div { static VECTORS_CONSTEXPR real apply(real a, real b) { return a / b; } };
+    struct op_min { static VECTORS_CONSTEXPR real apply(real a, real b) { return a < b ? a : b; } };
+    struct op_max { static VECTORS_CONSTEXPR real apply(real a, real b) { return a > b ? a : b; } };
+    struct op_negate { static VECTORS_CONSTEXPR real apply(real a) { return -a; } };
+    struct op_abs { static real apply(real a) { return real_abs(a); } };
+
+    /* Expression nodes are small and held by value; vectors are held by reference. */
+    template <typename Expr> struct operand { typedef const Expr type; };
+    template <unsigned Size> struct operand< Vec<Size> > { typedef const Vec<Size> &type; };
+}
+
+/* -------------------------------------------------------------------------
+   Per-vector expressions
+   ------------------------------------------------------------------------- */
+
+/* CRTP base of every vector expression; Derived provides `real eval(unsigned i) const`. */
+template <typename Derived, unsigned Size>
+struct VecExpr
+{
+    VECTORS_CONSTEXPR const Derived &self() const { return static_cast<const Derived &>(*this); }
+};
+
+/* Per-component binary operation. */
+template <typename Op, typename Lhs, typename Rhs, unsigned Size>
+struct VecBinary : public VecExpr<VecBinary<Op, Lhs, Rhs, Size>, Size>
+{
+    typename detail::operand<Lhs>::type lhs;
+    typename detail::operand<Rhs>::type rhs;
+    VECTORS_CONSTEXPR VecBinary(const Lhs &l, const Rhs &r) : lhs(l), rhs(r) {}
+    VECTORS_CONSTEXPR real eval(unsigned i) const { return Op::apply(lhs.eval(i), rhs.eval(i)); }
+};
+
+/* Per-component unary operation. */
+template <typename Op, typename Arg, unsigned Size>
+struct VecUnary : public VecExpr<VecUnary<Op, Arg, Size>, Size>
+{
+    typename detail::operand<Arg>::type arg;
+    VECTORS_CONSTEXPR explicit VecUnary(const Arg &a) : arg(a) {}
+    VECTORS_CONSTEXPR real eval(unsigned i) const { return Op::apply(arg.eval(i)); }
+};
+
+/* A scalar broadcast to every component. */
+template <unsigned Size>
+struct VecScalar : public VecExpr<VecScalar<Size>, Size>
+{
+    real value;
+    VECTORS_CONSTEXPR explicit VecScalar(real v) : value(v) {}
+    VECTORS_CONSTEXPR real eval(unsigned) const { return value; }
+};
+
+/* Read-only view of the components of a C vector (used for array elements). */
+template <unsigned Size>
+struct VecView : public VecExpr<VecView<Size>, Size>
+{
+    const real *components;
+    VECTORS_CONSTEXPR explicit VecView(const real *c) : components(c) {}
+    VECTORS_CONSTEXPR real eval(unsigned i) const { return components[i]; }
+};
+
+/* 3-component cross product. */
+template <typename Lhs, typename Rhs>
+struct VecCross : public VecExpr<VecCross<Lhs, Rhs>, 3>
+{
+    typename detail::operand<Lhs>::type lhs;
+    typename detail::operand<Rhs>::type rhs;
+    VECTORS_CONSTEXPR VecCross(const Lhs &l, const Rhs &r) : lhs(l), rhs(r) {}
+    VECTORS_CONSTEXPR real eval(unsigned i) const
+    {
+        return lhs.eval((i + 1) % 3) * rhs.eval((i + 2) % 3) - rhs.eval((i + 1) % 3) * lhs.eval((i + 2) % 3);
+    }
+};
+
+/* A concrete vector wrapping vec2/vec3/vec4.
+   Only `components` is touched so the union stays usable in constant expressions. */
+template <unsigned Size>
+class Vec : public VecExpr<Vec<Size>, Size>
+{
+public:
+    typedef typename detail::c_vector<Size>::type c_type;
+    c_type value;
+
+    Vec() {}
+    VECTORS_CONSTEXPR Vec(const c_type &v) : value(v) {}
+    VECTORS_CONSTEXPR explicit Vec(real s) : value()
+    {
+        for (unsigned i = 0; i < Size; i++) value.components[i] = s;
+    }
+    VECTORS_CONSTEXPR Vec(real x_, real y_) : value()
+    {
+        static_assert(Size == 2, "Vec(x, y) requires a Vec2");
+        value.components[0] = x_; value.components[1] = y_;
+    }
+    VECTORS_CONSTEXPR Vec(real x_, real y_, real z_) : value()
+    {
+        static_assert(Size == 3, "Vec(x, y, z) requires a Vec3");
+        value.components[0] = x_; value.components[1] = y_; value.components[2] = z_;
+    }
+    VECTORS_CONSTEXPR Vec(real x_, real y_, real z_, real w_) : value()
+    {
+        static_assert(Size == 4, "Vec(x, y, z, w) requires a Vec4");
+        value.components[0] = x_; value.components[1] = y_; value.components[2] = z_; value.components[3] = w_;
+    }
+
+    template <typename Expr>
+    VECTORS_CONSTEXPR Vec(const VecExpr<Expr, Size> &e) : value() { assign(e.self()); }
+
+    template <typename Expr>
+    VECTORS_CONSTEXPR Vec &operator=(const VecExpr<Expr, Size> &e) { assign(e.self()); return *this; }
+
+    template <typename Expr>
+    VECTORS_CONSTEXPR Vec &operator+=(const VecExpr<Expr, Size> &e) { assign(VecBinary<detail::op_add, Vec, Expr, Size>(*this, e.self())); return *this; }
+    template <typename Expr>
+    VECTORS_CONSTEXPR Vec &operator-=(const VecExpr<Expr, Size> &e) { assign(VecBinary<detail::op_sub, Vec, Expr, Size>(*this, e.self())); return *this; }
+    VECTORS_CONSTEXPR Vec &operator*=(real s) { for (unsigned i = 0; i < Size; i++) value.components[i] *= s; return *this; }
+    VECTORS_CONSTEXPR Vec &operator/=(real s) { for (unsigned i = 0; i < Size; i++) value.components[i] /= s; return *this; }
+
+    VECTORS_CONSTEXPR operator c_type() const { return value; }
+
+    VECTORS_CONSTEXPR real eval(unsigned i) const { return value.components[i]; }
+    VECTORS_CONSTEXPR real &operator[](unsigned i) { return value.components[i]; }
+    VECTORS_CONSTEXPR real operator[](unsigned i) const { return value.components[i]; }
+
+    VECTORS_CONSTEXPR real &x() { return value.components[0]; }
+    VECTORS_CONSTEXPR real &y() { return value.components[1]; }
+    VECTORS_CONSTEXPR real &z() { static_assert(Size >= 3, "z() requires a Vec3 or Vec4"); return value.components[2]; }
+    VECTORS_CONSTEXPR real &w() { static_assert(Size >= 4, "w() requires a Vec4"); return value.components[3]; }
+    VECTORS_CONSTEXPR real x() const { return value.components[0]; }
+    VECTORS_CONSTEXPR real y() const { return value.components[1]; }
+    VECTORS_CONSTEXPR real z() const { static_assert(Size >= 3, "z() requires a Vec3 or Vec4"); return value.components[2]; }
+    VECTORS_CONSTEXPR real w() const { static_assert(Size >= 4, "w() requires a Vec4"); return value.components[3]; }
+
+private:
+    /* Evaluate into a scratch array first so expressions may read the destination. */
+    template <typename Expr>
+    VECTORS_CONSTEXPR void assign(const Expr &e)
+    {
+        real evaluated[Size] = {};
+        for (unsigned i = 0; i < Size; i++) evaluated[i] = e.eval(i);
+        for (unsigned i = 0; i < Size; i++) value.components[i] = evaluated[i];
+    }
+};
+
+typedef Vec<2> Vec2;
+typedef Vec<3> Vec3;
+typedef Vec<4> Vec4;
+
+/* Generates vector/vector, vector/scalar and scalar/vector forms of a per-component operator. */
+#define VECTORS_HPP_VEC_OPERATOR(symbol, op)                                                                \
+    template <typename Lhs, typename Rhs, unsigned Size>                                                    \
+    VECTORS_CONSTEXPR VecBinary<op, Lhs, Rhs, Size> operator symbol(const VecExpr<Lhs, Size> &lhs, const VecExpr<Rhs, Size> &rhs) \
+    { return VecBinary<op, Lhs, Rhs, Size>(lhs.self(), rhs.self()); }                                      \
+    template <typename Lhs, unsigned Size>                                                                  \
+    VECTORS_CONSTEXPR VecBinary<op, Lhs, VecScalar<Size>, Size> operator symbol(const VecExpr<Lhs, Size> &lhs, real rhs) \
+    { return VecBinary<op, Lhs, VecScalar<Size>, Size>(lhs.self(), VecScalar<Size>(rhs)); }                 \
+    template <typename Rhs, unsigned Size>                                                                  \
+    VECTORS_CONSTEXPR VecBinary<op, VecScalar<Size>, Rhs, Size> operator symbol(real lhs, const VecExpr<Rhs, Size> &rhs) \
+    { return VecBinary<op, VecScalar<Size>, Rhs, Size>(VecScalar<Size>(lhs), rhs.self()); }
+
+VECTORS_HPP_VEC_OPERATOR(+, detail::op_add)
+VECTORS_HPP_VEC_OPERATOR(-, detail::op_sub)
+VECTORS_HPP_VEC_OPERATOR(*, detail::op_mul)
+VECTORS_HPP_VEC_OPERATOR(/, detail::op_div)
+
+#undef VECTORS_HPP_VEC_OPERATOR
+
+/* Per-component negation. */
+template <typename Arg, unsigned Size>
+VECTORS_CONSTEXPR VecUnary<detail::op_negate, Arg, Size> operator-(const VecExpr<Arg, Size> &arg)
+{
+    return VecUnary<detail::op_negate, Arg, Size>(arg.self());
+}
+
+/* Per-component absolute-value. */
+template <typename Arg, unsigned Size>
+inline VecUnary<detail::op_abs, Arg, Size> abs(const VecExpr<Arg, Size> &arg)
+{
+    return VecUnary<detail::op_abs, Arg, Size>(arg.self());
+}
+
+/* Per-component minimum. */
+template <typename Lhs, typename Rhs, unsigned Size>
+VECTORS_CONSTEXPR VecBinary<detail::op_min, Lhs, Rhs, Size> min(const VecExpr<Lhs, Size> &lhs, const VecExpr<Rhs, Size> &rhs)
+{
+    return VecBinary<detail::op_min, Lhs, Rhs, Size>(lhs.self(), rhs.self());
+}
+
+/* Per-component maximum. */
+template <typename Lhs, typename Rhs, unsigned Size>
+VECTORS_CONSTEXPR VecBinary<detail::op_max, Lhs, Rhs, Size> max(const VecExpr<Lhs, Size> &lhs, const VecExpr<Rhs, Size> &rhs)
+{
+    return VecBinary<detail::op_max, Lhs, Rhs, Size>(lhs.self(), rhs.self());
+}
+
+/* 3-component cross product. */
+template <typename Lhs, typename Rhs>
+VECTORS_CONSTEXPR VecCross<Lhs, Rhs> cross(const VecExpr<Lhs, 3> &lhs, const VecExpr<Rhs, 3> &rhs)
+{
+    return VecCross<Lhs, Rhs>(lhs.self(), rhs.self());
+}
+
+/* Linear interpolation, fused as src0 + (src1 - src0) * t. */
+template <typename Lhs, typename Rhs, unsigned Size>
+VECTORS_CONSTEXPR VecBinary<detail::op_add, Lhs, VecBinary<detail::op_mul, VecBinary<detail::op_sub, Rhs, Lhs, Size>, VecScalar<Size>, Size>, Size>
+lerp(const VecExpr<Lhs, Size> &src0, const VecExpr<Rhs, Size> &src1, real t)
+{
+    return src0 + (src1 - src0) * t;
+}
+
+/* Dot product. */
+template <typename Lhs, typename Rhs, unsigned Size>
+VECTORS_CONSTEXPR real dot(const VecExpr<Lhs, Size> &lhs, const VecExpr<Rhs, Size> &rhs)
+{
+    real sum = lhs.self().eval(0) * rhs.self().eval(0);
+    for (unsigned i = 1; i < Size; i++) sum += lhs.self().eval(i) * rhs.self().eval(i);
+    return sum;
+}
+
+/* Magnitude/Length */
+template <typename Arg, unsigned Size>
+inline real magnitude(const VecExpr<Arg, Size> &arg)
+{
+    Vec<Size> evaluated(arg);
+    return real_sqrt(dot(evaluated, evaluated));
+}
+
+/* Euclidean distance. */
+template <typename Lhs, typename Rhs, unsigned Size>
+inline real distance(const VecExpr<Lhs, Size> &lhs, const VecExpr<Rhs, Size> &rhs)
+{
+    return magnitude(lhs - rhs);
+}
+
+/* Unit-vector */
+template <typename Arg, unsigned Size>
+inline Vec<Size> normalize(const VecExpr<Arg, Size> &arg)
+{
+    Vec<Size> evaluated(arg);
+    return Vec<Size>(evaluated * (1.0f / real_sqrt(dot(evaluated, evaluated))));
+}
+
+/* -------------------------------------------------------------------------
+   Quaternions and matrices - products mix components, so they are evaluated
+   eagerly. The arithmetic mirrors quat_mul/mat4_mul so it can run at compile
+   time; anything needing libm goes through the C functions.
+   ------------------------------------------------------------------------- */
+
+/* Quaternion wrapping a vec4 (i, j, k, w). */
+class Quat
+{
+public:
+    vec4 value;
+
+    Quat() {}
+    VECTORS_CONSTEXPR Quat(const vec4 &q) : value(q) {}
+    VECTORS_CONSTEXPR Quat(real i_, real j_, real k_, real w_) : value()
+    {
+        value.components[0] = i_; value.components[1] = j_; value.components[2] = k_; value.components[3] = w_;
+    }
+
+    static VECTORS_CONSTEXPR Quat identity() { return Quat(0.0f, 0.0f, 0.0f, 1.0f); }
+    static Quat from_axis_angle(const Vec3 &axis, real radians) { return Quat(quat_from_axis_angle(axis.value, radians)); }
+    static Quat between(const Vec3 &from, const Vec3 &to) { return Quat(quat_between_vec3(from.value, to.value)); }
+
+    VECTORS_CONSTEXPR operator vec4() const { return value; }
+
+    VECTORS_CONSTEXPR real i() const { return value.components[0]; }
+    VECTORS_CONSTEXPR real j() const { return value.components[1]; }
+    VECTORS_CONSTEXPR real k() const { return value.components[2]; }
+    VECTORS_CONSTEXPR real w() const { return value.components[3]; }
+
+    VECTORS_CONSTEXPR Quat conjugate() const { return Quat(-i(), -j(), -k(), w()); }
+    VECTORS_CONSTEXPR Quat inverse() const
+    {
+        real magnitude_squared = i() * i() + j() * j() + k() * k() + w() * w();
+        return Quat(-i() / magnitude_squared, -j() / magnitude_squared, -k() / magnitude_squared, w() / magnitude_squared);
+    }
+    Quat normalized() const { return Quat(vec4_normalize(value)); }
+    Vec3 rotate(const Vec3 &v) const { return Vec3(quat_rotate_vec3(value, v.value)); }
+};
+
+/* Hamilton product. */
+VECTORS_CONSTEXPR Quat operator*(const Quat &a, const Quat &b)
+{
+    return Quat(
+        (a.w() * b.i()) + (a.i() * b.w()) + (a.j() * b.k()) - (a.k() * b.j()),
+        (a.w() * b.j()) - (a.i() * b.k()) + (a.j() * b.w()) + (a.k() * b.i()),
+        (a.w() * b.k()) + (a.i() * b.j()) - (a.j() * b.i()) + (a.k() * b.w()),
+        (a.w() * b.w()) - (a.i() * b.i()) - (a.j() * b.j()) - (a.k() * b.k()));
+}
+
+/* Rotate a vector expression by a quaternion. */
+template <typename Arg>
+inline Vec3 operator*(const Quat &rotation, const VecExpr<Arg, 3> &vector)
+{
+    return rotation.rotate(Vec3(vector));
+}
+
+inline Quat nlerp(const Quat &src0, const Quat &src1, real factor) { return Quat(quat_nlerp(src0.value, src1.value, factor)); }
+inline Quat slerp(const Quat &src0, const Quat &src1, real factor) { return Quat(quat_slerp(src0.value, src1.value, factor)); }
+
+/* 4x4 matrix wrapping a mat4; (row, column) indexing matches mat4.transpose.
+   Only `data` is touched so the union stays usable in constant expressions. */
+class Mat4
+{
+public:
+    mat4 value;
+
+    Mat4() {}
+    VECTORS_CONSTEXPR Mat4(const mat4 &m) : value(m) {}
+
+    static VECTORS_CONSTEXPR Mat4 zero() { return Mat4(mat4()); }
+    static VECTORS_CONSTEXPR Mat4 identity()
+    {
+        Mat4 r = zero();
+        r(0, 0) = 1.0f; r(1, 1) = 1.0f; r(2, 2) = 1.0f; r(3, 3) = 1.0f;
+        return r;
+    }
+    static Mat4 perspective(real fov_y, real aspect, real near_plane, real far_plane) { return Mat4(mat4_perspective(fov_y, aspect, near_plane, far_plane)); }
+    static Mat4 orthographic(real left, real right, real bottom, real top, real near_plane, real far_plane) { return Mat4(mat4_orthographic(left, right, bottom, top, near_plane, far_plane)); }
+    static Mat4 lookat(const Vec3 &eye, const Vec3 &center, const Vec3 &up) { return Mat4(mat4_lookat(eye.value, center.value, up.value)); }
+
+    VECTORS_CONSTEXPR operator mat4() const { return value; }
+
+    VECTORS_CONSTEXPR real &operator()(unsigned row, unsigned column) { return value.data[row * 4 + column]; }
+    VECTORS_CONSTEXPR real operator()(unsigned row, unsigned column) const { return value.data[row * 4 + column]; }
+};
+
+VECTORS_CONSTEXPR Mat4 operator*(const Mat4 &a, const Mat4 &b)
+{
+    Mat4 r = Mat4::zero();
+    for (unsigned i = 0; i < 4; i++)
+    {
+        for (unsigned j = 0; j < 4; j++)
+        {
+            for (unsigned k = 0; k < 4; k++)
+            {
+                r(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+    return r;
+}
+
+/* Transform a vector expression (evaluated once, then multiplied). */
+template <typename Arg>
+VECTORS_CONSTEXPR Vec4 operator*(const Mat4 &m, const VecExpr<Arg, 4> &v)
+{
+    Vec4 evaluated(v);
+    Vec4 r(0.0f);
+    for (unsigned i = 0; i < 4; i++)
+    {
+        r[i] = m(i, 0) * evaluated[0] + m(i, 1) * evaluated[1] + m(i, 2) * evaluated[2] + m(i, 3) * evaluated[3];
+    }
+    return r;
+}
+
+/* -------------------------------------------------------------------------
+   cx - constexpr replacements for the libm-dependent builders. Trig and
+   square roots are evaluated in double (range reduction plus series, Newton
+   iteration) and are accurate to float precision, so results match the C
+   builders to within rounding. They also work at run time, but the C
+   functions are faster there.
+   ------------------------------------------------------------------------- */
+
+namespace cx
+{
+    /* Degrees to radians. */
+    VECTORS_CONSTEXPR real radians(real degrees)
+    {
+        return (real)((double)degrees * (3.14159265358979323846 / 180.0));
+    }
+
+    /* Square root by Newton iteration. */
+    VECTORS_CONSTEXPR double sqrt_double(double x)
+    {
+        if (!(x > 0.0) || x > 1.0e300) return x == 0.0 || x > 1.0e300 ? x : (x - x) / (x - x);
+        double guess = x > 1.0 ? x : 1.0;
+        for (int iteration = 0; iteration < 1100; iteration++)
+        {
+            double next = 0.5 * (guess + x / guess);
+            if (next >= guess) break;
+            guess = next;
+        }
+        return guess;
+    }
+
+    /* Sine and cosine of x, reduced to [-pi/4, pi/4] around the nearest multiple of pi/2. */
+    VECTORS_CONSTEXPR void sin_cos_double(double x, double &sine, double &cosine)
+    {
+        const double half_pi_hi = 1.57079632679489655800e+00;
+        const double half_pi_lo = 6.12323399573676603587e-17;
+        double quadrant = x * 0.63661977236758134308;
+        long long k = (long long)(quadrant < 0.0 ? quadrant - 0.5 : quadrant + 0.5);
+        double r = (x - (double)k * half_pi_hi) - (double)k * half_pi_lo;
+        double r2 = r * r;
+        double s = r, c = 1.0, term_s = r, term_c = 1.0;
+        for (int n = 1; n <= 10; n++)
+        {
+            term_s *= -r2 / (double)((2 * n) * (2 * n + 1));
+            term_c *= -r2 / (double)((2 * n - 1) * (2 * n));
+            s += term_s;
+            c += term_c;
+        }
+        switch (((k % 4) + 4) % 4)
+        {
+            case 0: sine = s; cosine = c; break;
+            case 1: sine = c; cosine = -s; break;
+            case 2: sine = -s; cosine = -c; break;
+            default: sine = -c; cosine = s; break;
+        }
+    }
+
+    VECTORS_CONSTEXPR real sqrt(real x) { return (real)sqrt_double((double)x); }
+    VECTORS_CONSTEXPR real sin(real x) { double s = 0.0, c = 0.0; sin_cos_double((double)x, s, c); return (real)s; }
+    VECTORS_CONSTEXPR real cos(real x) { double s = 0.0, c = 0.0; sin_cos_double((double)x, s, c); return (real)c; }
+    VECTORS_CONSTEXPR real tan(real x) { double s = 0.0, c = 0.0; sin_cos_double((double)x, s, c); return (real)(s / c); }
+
+    /* Magnitude/Length */
+    template <typename Arg, unsigned Size>
+    VECTORS_CONSTEXPR real magnitude(const VecExpr<Arg, Size> &arg)
+    {
+        Vec<Size> evaluated(arg);
+        return cx::sqrt(dot(evaluated, evaluated));
+    }
+
+    /* Unit-vector */
+    template <typename Arg, unsigned Size>
+    VECTORS_CONSTEXPR Vec<Size> normalize(const VecExpr<Arg, Size> &arg)
+    {
+        Vec<Size> evaluated(arg);
+        return Vec<Size>(evaluated / cx::magnitude(evaluated));
+    }
+
+    /* Same as mat4_perspective. */
+    VECTORS_CONSTEXPR Mat4 perspective(real fov_y, real aspect, real near_plane, real far_plane)
+    {
+        Mat4 r = Mat4::zero();
+        real tan_half_fov = cx::tan(fov_y * 0.5f);
+        r(0, 0) = 1.0f / (aspect * tan_half_fov);
+        r(1, 1) = 1.0f / tan_half_fov;
+        r(2, 2) = (far_plane + near_plane) / (near_plane - far_plane);
+        r(2, 3) = (2.0f * far_plane * near_plane) / (near_plane - far_plane);
+        r(3, 2) = -1.0f;
+        return r;
+    }
+
+    /* Same as mat4_perspective_zo. */
+    VECTORS_CONSTEXPR Mat4 perspective_zo(real fov_y, real aspect, real near_plane, real far_plane)
+    {
+        Mat4 r = Mat4::zero();
+        real tan_half_fov = cx::tan(fov_y * 0.5f);
+        r(0, 0) = 1.0f / (aspect * tan_half_fov);
+        r(1, 1) = 1.0f / tan_half_fov;
+        r(2, 2) = far_plane / (near_plane - far_plane);
+        r(2, 3) = (far_plane * near_plane) / (near_plane - far_plane);
+        r(3, 2) = -1.0f;
+        return r;
+    }
+
+    /* Same as mat4_orthographic. */
+    VECTORS_CONSTEXPR Mat4 orthographic(real left, real right, real bottom, real top, real near_plane, real far_plane)
+    {
+        Mat4 r = Mat4::zero();
+        r(0, 0) = 2.0f / (right - left);
+        r(1, 1) = 2.0f / (top - bottom);
+        r(2, 2) = -2.0f / (far_plane - near_plane);
+        r(0, 3) = -(right + left) / (right - left);
+        r(1, 3) = -(top + bottom) / (top - bottom);
+        r(2, 3) = -(far_plane + near_plane) / (far_plane - near_plane);
+        r(3, 3) = 1.0f;
+        return r;
+    }
+
+    /* Same as mat4_lookat. */
+    VECTORS_CONSTEXPR Mat4 lookat(const Vec3 &eye, const Vec3 &center, const Vec3 &up)
+    {
+        Mat4 r = Mat4::zero();
+        Vec3 forward(center - eye);
+        real forward_len = cx::magnitude(forward);
+        if (forward_len < (real)0.0001) /* VECTORS_QUAT_EPSILON is not a constant expression */
+        {
+            forward = Vec3(0.0f, 0.0f, -1.0f);
+        }
+        else
+        {
+            forward /= forward_len;
+        }
+        Vec3 side(cx::normalize(cross(forward, up)));
+        Vec3 up_cross(cross(side, forward));
+        for (unsigned column = 0; column < 3; column++)
+        {
+            r(0, column) = side[column];
+            r(1, column) = up_cross[column];
+            r(2, column) = -forward[column];
+        }
+        r(0, 3) = -dot(side, eye);
+        r(1, 3) = -dot(up_cross, eye);
+        r(2, 3) = dot(forward, eye);
+        r(3, 3) = 1.0f;
+        return r;
+    }
+
+    /* Same as quat_from_axis_angle. */
+    VECTORS_CONSTEXPR Quat quat_from_axis_angle(const Vec3 &axis, real radians)
+    {
+        real sin_half = cx::sin(radians * 0.5f);
+        real cos_half = cx::cos(radians * 0.5f);
+        Vec3 unit_axis(cx::normalize(axis));
+        return Quat(unit_axis[0] * sin_half, unit_axis[1] * sin_half, unit_axis[2] * sin_half, cos_half);
+    }
+}
+
+/* -------------------------------------------------------------------------
+   Array expressions - the same operators applied element-wise over Spans
+   of C vectors, evaluated in one pass on assignment to a Span:
+       Span3(out, n) = Span3(a, n) * dt + Span3(b, n);
+   Operands must hold at least as many elements as the destination.
+   ------------------------------------------------------------------------- */
+
+/* CRTP base of every array expression; Derived provides `element_type element(u32 k) const`. */
+template <typename Derived, unsigned Size>
+struct ArrayExpr
+{
+    const Derived &self() const { return static_cast<const Derived &>(*this); }
+};
+
+/* Element-wise binary operation. */
+template <typename Op, typename Lhs, typename Rhs, unsigned Size>
+struct ArrayBinary : public ArrayExpr<ArrayBinary<Op, Lhs, Rhs, Size>, Size>
+{
+    typedef VecBinary<Op, typename Lhs::element_type, typename Rhs::element_type, Size> element_type;
+    Lhs lhs;
+    Rhs rhs;
+    ArrayBinary(const Lhs &l, const Rhs &r) : lhs(l), rhs(r) {}
+    element_type element(u32 k) const { return element_type(lhs.element(k), rhs.element(k)); }
+};
+
+/* Element-wise unary operation. */
+template <typename Op, typename Arg, unsigned Size>
+struct ArrayUnary : public ArrayExpr<ArrayUnary<Op, Arg, Size>, Size>
+{
+    typedef VecUnary<Op, typename Arg::element_type, Size> element_type;
+    Arg arg;
+    explicit ArrayUnary(const Arg &a) : arg(a) {}
+    element_type element(u32 k) const { return element_type(arg.element(k)); }
+};
+
+/* Element-wise cross product. */
+template <typename Lhs, typename Rhs>
+struct ArrayCross : public ArrayExpr<ArrayCross<Lhs, Rhs>, 3>
+{
+    typedef VecCross<typename Lhs::element_type, typename Rhs::element_type> element_type;
+    Lhs lhs;
+    Rhs rhs;
+    ArrayCross(const Lhs &l, const Rhs &r) : lhs(l), rhs(r) {}
+    element_type element(u32 k) const { return element_type(lhs.element(k), rhs.element(k)); }
+};
+
+/* A scalar broadcast to every element. */
+template <unsigned Size>
+struct ArrayScalar : public ArrayExpr<ArrayScalar<Size>, Size>
+{
+    typedef VecScalar<Size> element_type;
+    real value;
+    explicit ArrayScalar(real v) : value(v) {}
+    element_type element(u32) const { return element_type(value); }
+};
+
+/* A single vector broadcast to every element. */
+template <unsigned Size>
+struct ArrayBroadcast : public ArrayExpr<ArrayBroadcast<Size>, Size>
+{
+    typedef VecView<Size> element_type;
+    const real *components;
+    explicit ArrayBroadcast(const Vec<Size> &v) : components(v.value.components) {}
+    element_type element(u32) const { return element_type(components); }
+};
+
+/* A mutable view over `count` contiguous C vectors. Assigning to a Span writes the elements, it never rebinds it. */
+template <unsigned Size>
+class Span : public ArrayExpr<Span<Size>, Size>
+{
+public:
+    typedef typename detail::c_vector<Size>::type c_type;
+    typedef VecView<Size> element_type;
+
+    c_type *data;
+    u32 count;
+
+    Span(c_type *d, u32 n) : data(d), count(n) {}
+    Span(const Span &other) : data(other.data), count(other.count) {}
+
+    element_type element(u32 k) const { return element_type(data[k].components); }
+    u32 size() const { return count; }
+    c_type &operator[](u32 k) { return data[k]; }
+    const c_type &operator[](u32 k) const { return data[k]; }
+
+    Span &operator=(const Span &other) { assign(other); return *this; }
+
+    template <typename Expr>
+    Span &operator=(const ArrayExpr<Expr, Size> &e) { assign(e.self()); return *this; }
+
+    template <typename Expr>
+    Span &operator+=(const ArrayExpr<Expr, Size> &e) { assign(ArrayBinary<detail::op_add, Span, Expr, Size>(*this, e.self())); return *this; }
+    template <typename Expr>
+    Span &operator-=(const ArrayExpr<Expr, Size> &e) { assign(ArrayBinary<detail::op_sub, Span, Expr, Size>(*this, e.self())); return *this; }
+    Span &operator*=(real s) { assign(ArrayBinary<detail::op_mul, Span, ArrayScalar<Size>, Size>(*this, ArrayScalar<Size>(s))); return *this; }
+
+private:
+    template <typename Expr>
+    void assign(const Expr &e)
+    {
+        u32 k;
+        for (k = 0; k < count; k++)
+        {
+            typename Expr::element_type element = e.element(k);
+            real evaluated[Size];
+            unsigned i;
+            for (i = 0; i < Size; i++) evaluated[i] = element.eval(i);
+            for (i = 0; i < Size; i++) data[k].components[i] = evaluated[i];
+        }
+    }
+};
+
+typedef Span<2> Span2;
+typedef Span<3> Span3;
+typedef Span<4> Span4;
+
+/* A read-only view over `count` contiguous C vectors, usable as an expression operand. */
+template <unsigned Size>
+struct ConstSpan : public ArrayExpr<ConstSpan<Size>, Size>
+{
+    typedef typename detail::c_vector<Size>::type c_type;
+    typedef VecView<Size> element_type;
+
+    const c_type *data;
+    u32 count;
+
+    ConstSpan(const c_type *d, u32 n) : data(d), count(n) {}
+    ConstSpan(const Span<Size> &s) : data(s.data), count(s.count) {}
+
+    element_type element(u32 k) const { return element_type(data[k].components); }
+    u32 size() const { return count; }
+    const c_type &operator[](u32 k) const { return data[k]; }
+};
+
+typedef ConstSpan<2> ConstSpan2;
+typedef ConstSpan<3> ConstSpan3;
+typedef ConstSpan<4> ConstSpan4;
+
+/* Generates array/array, array/scalar, scalar/array and array/vector (broadcast) forms of an element-wise operator. */
+#define VECTORS_HPP_ARRAY_OPERATOR(symbol, op)                                                              \
+    template <typename Lhs, typename Rhs, unsigned Size>                                                    \
+    inline ArrayBinary<op, Lhs, Rhs, Size> operator symbol(const ArrayExpr<Lhs, Size> &lhs, const ArrayExpr<Rhs, Size> &rhs) \
+    { return ArrayBinary<op, Lhs, Rhs, Size>(lhs.self(), rhs.self()); }                                    \
+    template <typename Lhs, unsigned Size>                                                                  \
+    inline ArrayBinary<op, Lhs, ArrayScalar<Size>, Size> operator symbol(const ArrayExpr<Lhs, Size> &lhs, real rhs) \
+    { return ArrayBinary<op, Lhs, ArrayScalar<Size>, Size>(lhs.self(), ArrayScalar<Size>(rhs)); }           \
+    template <typename Rhs, unsigned Size>                                                                  \
+    inline ArrayBinary<op, ArrayScalar<Size>, Rhs, Size> operator symbol(real lhs, const ArrayExpr<Rhs, Size> &rhs) \
+    { return ArrayBinary<op, ArrayScalar<Size>, Rhs, Size>(ArrayScalar<Size>(lhs), rhs.self()); }           \
+    template <typename Lhs, unsigned Size>                                                                  \
+    inline ArrayBinary<op, Lhs, ArrayBroadcast<Size>, Size> operator symbol(const ArrayExpr<Lhs, Size> &lhs, const Vec<Size> &rhs) \
+    { return ArrayBinary<op, Lhs, ArrayBroadcast<Size>, Size>(lhs.self(), ArrayBroadcast<Size>(rhs)); }
+
+VECTORS_HPP_ARRAY_OPERATOR(+, detail::op_add)
+VECTORS_HPP_ARRAY_OPERATOR(-, detail::op_sub)
+VECTORS_HPP_ARRAY_OPERATOR(*, detail::op_mul)
+VECTORS_HPP_ARRAY_OPERATOR(/, detail::op_div)
+
+#undef VECTORS_HPP_ARRAY_OPERATOR
+
+/* Element-wise negation. */
+template <typename Arg, unsigned Size>
+inline ArrayUnary<detail::op_negate, Arg, Size> operator-(const ArrayExpr<Arg, Size> &arg)
+{
+    return ArrayUnary<detail::op_negate, Arg, Size>(arg.self());
+}
+
+/* Element-wise minimum. */
+template <typename Lhs, typename Rhs, unsigned Size>
+inline ArrayBinary<detail::op_min, Lhs, Rhs, Size> min(const ArrayExpr<Lhs, Size> &lhs, const ArrayExpr<Rhs, Size> &rhs)
+{
+    return ArrayBinary<detail::op_min, Lhs, Rhs, Size>(lhs.self(), rhs.self());
+}
+
+/* Element-wise maximum. */
+template <typename Lhs, typename Rhs, unsigned Size>
+inline ArrayBinary<detail::op_max, Lhs, Rhs, Size> max(const ArrayExpr<Lhs, Size> &lhs, const ArrayExpr<Rhs, Size> &rhs)
+{
+    return ArrayBinary<detail::op_max, Lhs, Rhs, Size>(lhs.self(), rhs.self());
+}
+
+/* Element-wise cross product. */
+template <typename Lhs, typename Rhs>
+inline ArrayCross<Lhs, Rhs> cross(const ArrayExpr<Lhs, 3> &lhs, const ArrayExpr<Rhs, 3> &rhs)
+{
+    return ArrayCross<Lhs, Rhs>(lhs.self(), rhs.self());
+}
+
+/* Element-wise linear interpolation with a shared factor. */
+template <typename Lhs, typename Rhs, unsigned Size>
+inline ArrayBinary<detail::op_add, Lhs, ArrayBinary<detail::op_mul, ArrayBinary<detail::op_sub, Rhs, Lhs, Size>, ArrayScalar<Size>, Size>, Size>
+lerp(const ArrayExpr<Lhs, Size> &src0, const ArrayExpr<Rhs, Size> &src1, real t)
+{
+    return src0 + (src1 - src0) * t;
+}
+
+/* -------------------------------------------------------------------------
+   Generic vectors and matrices - VecN<Scalar, Size> and MatMxN<Scalar,
+   Rows, Columns> over any arithmetic type (float, double, i32, Fixed<>).
+   Operators are eager; the per-type work is routed through detail::vec_ops
+   and detail::mat_ops, which are specialized with SSE for Vec4f/Mat4f and
+   AVX for Vec4d when the target supports them (define VECTORS_NO_SIMD to
+   force the portable loops). Instances over `real` with 2..4 components
+   convert to and from the C vec/mat unions, row-major like mat4.transpose.
+   ------------------------------------------------------------------------- */
+
+/* Signed fixed-point number stored in an i32 with FracBits fractional bits. */
+template <unsigned FracBits>
+class Fixed
+{
+public:
+    i32 raw;
+
+    Fixed() {}
+    explicit Fixed(int integer) : raw(saturate((i64)integer * ((i64)1 << FracBits))) {}
+    explicit Fixed(double value) : raw((i32)(value * (double)(1 << FracBits) + (value < 0.0 ? -0.5 : 0.5))) {}
+    static Fixed from_raw(i32 bits) { Fixed f; f.raw = bits; return f; }
+
+    explicit operator double() const { return (double)raw / (double)(1 << FracBits); }
+    explicit operator float() const { return (float)((double)raw / (double)(1 << FracBits)); }
+
+    Fixed operator-() const { return from_raw(-raw); }
+    Fixed &operator+=(Fixed o) { raw += o.raw; return *this; }
+    Fixed &operator-=(Fixed o) { raw -= o.raw; return *this; }
+    Fixed &operator*=(Fixed o) { raw = (i32)(((i64)raw * o.raw) >> FracBits); return *this; }
+    Fixed &operator/=(Fixed o) { raw = (i32)(((i64)raw * ((i64)1 << FracBits)) / o.raw); return *this; }
+
+    friend Fixed operator+(Fixed a, Fixed b) { return a += b; }
+    friend Fixed operator-(Fixed a, Fixed b) { return a -= b; }
+    friend Fixed operator*(Fixed a, Fixed b) { return a *= b; }
+    friend Fixed operator/(Fixed a, Fixed b) { return a /= b; }
+    friend bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+    friend bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+    friend bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+    friend bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+
+private:
+    /* Clamp a widened value to the i32 range instead of overflowing. */
+    static i32 saturate(i64 value) { return (i32)(value > 0x7fffffff ? 0x7fffffff : (value < -0x7fffffff - 1 ? -0x7fffffff - 1 : value)); }
+};
+
+typedef Fixed<16> Fixed16;
+
+namespace detail
+{
+    /* The C type a generic vector/matrix converts to, or an unusable placeholder. */
+    struct no_c_type {};
+    template <typename Scalar, unsigned Size> struct c_vector_of { typedef no_c_type type; };
+    template <> struct c_vector_of<real, 2> { typedef vec2 type; };
+    template <> struct c_vector_of<real, 3> { typedef vec3 type; };
+    template <> struct c_vector_of<real, 4> { typedef vec4 type; };
+    template <typename Scalar, unsigned Rows, unsigned Columns> struct c_matrix_of { typedef no_c_type type; };
+    template <> struct c_matrix_of<real, 2, 2> { typedef mat2 type; };
+    template <> struct c_matrix_of<real, 3, 3> { typedef mat3 type; };
+    template <> struct c_matrix_of<real, 4, 4> { typedef mat4 type; };
+
+    inline float square_root(float x) { return (float)::sqrt((double)x); }
+    inline double square_root(double x) { return ::sqrt(x); }
+    template <typename Scalar> inline Scalar square_root(Scalar x) { return Scalar(::sqrt((double)x)); }
+
+    /* Portable per-component kernels; the compiler unrolls them for small Size. */
+    template <typename Scalar, unsigned Size>
+    struct vec_ops
+    {
+        static void add(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] + b[i]; }
+        static void sub(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] - b[i]; }
+        static void mul(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] * b[i]; }
+        static void div(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] / b[i]; }
+        static void min(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] < b[i] ? a[i] : b[i]; }
+        static void max(const Scalar *a, const Scalar *b, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] > b[i] ? a[i] : b[i]; }
+        static void scale(const Scalar *a, Scalar s, Scalar *r) { for (unsigned i = 0; i < Size; i++) r[i] = a[i] * s; }
+        static Scalar dot(const Scalar *a, const Scalar *b)
+        {
+            Scalar sum = a[0] * b[0];
+            for (unsigned i = 1; i < Size; i++) sum += a[i] * b[i];
+            return sum;
+        }
+    };
+
+    /* Portable matrix kernels (row-major). */
+    template <typename Scalar, unsigned Rows, unsigned Inner, unsigned Columns>
+    struct mat_ops
+    {
+        static void mul(const Scalar *a, const Scalar *b, Scalar *r)
+        {
+            for (unsigned i = 0; i < Rows; i++)
+            {
+                for (unsigned j = 0; j < Columns; j++)
+                {
+                    Scalar sum = a[i * Inner] * b[j];
+                    for (unsigned k = 1; k < Inner; k++) sum += a[i * Inner + k] * b[k * Columns + j];
+                    r[i * Columns + j] = sum;
+                }
+            }
+        }
+        static void mul_vec(const Scalar *m, const Scalar *v, Scalar *r)
+        {
+            for (unsigned i = 0; i < Rows; i++) r[i] = vec_ops<Scalar, Inner>::dot(m + i * Inner, v);
+        }
+    };
+
+#if defined(VECTORS_HPP_SSE)
+    template <>
+    struct vec_ops<float, 4>
+    {
+        static void add(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_add_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void sub(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_sub_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void mul(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void div(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_div_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void min(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_min_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void max(const float *a, const float *b, float *r) { _mm_storeu_ps(r, _mm_max_ps(_mm_loadu_ps(a), _mm_loadu_ps(b))); }
+        static void scale(const float *a, float s, float *r) { _mm_storeu_ps(r, _mm_mul_ps(_mm_loadu_ps(a), _mm_set1_ps(s))); }
+        static float dot(const float *a, const float *b)
+        {
+            __m128 products = _mm_mul_ps(_mm_loadu_ps(a), _mm_loadu_ps(b));
+            __m128 swapped = _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 3, 0, 1));
+            __m128 sums = _mm_add_ps(products, swapped);
+            swapped = _mm_movehl_ps(swapped, sums);
+            return _mm_cvtss_f32(_mm_add_ss(sums, swapped));
+        }
+    };
+
+    template <>
+    struct mat_ops<float, 4, 4, 4>
+    {
+        /* Each result row is a broadcast-weighted sum of the rows of b. */
+        static void mul(const float *a, const float *b, float *r)
+        {
+            __m128 b0 = _mm_loadu_ps(b), b1 = _mm_loadu_ps(b + 4), b2 = _mm_loadu_ps(b + 8), b3 = _mm_loadu_ps(b + 12);
+            for (unsigned i = 0; i < 4; i++)
+            {
+                __m128 row = _mm_mul_ps(_mm_set1_ps(a[i * 4 + 0]), b0);
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i * 4 + 1]), b1));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i * 4 + 2]), b2));
+                row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i * 4 + 3]), b3));
+                _mm_storeu_ps(r + i * 4, row);
+            }
+        }
+        /* Four row products, transposed so the horizontal sums become vertical adds. */
+        static void mul_vec(const float *m, const float *v, float *r)
+        {
+            __m128 vector = _mm_loadu_ps(v);
+            __m128 r0 = _mm_mul_ps(_mm_loadu_ps(m), vector);
+            __m128 r1 = _mm_mul_ps(_mm_loadu_ps(m + 4), vector);
+            __m128 r2 = _mm_mul_ps(_mm_loadu_ps(m + 8), vector);
+            __m128 r3 = _mm_mul_ps(_mm_loadu_ps(m + 12), vector);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(r, _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3)));
+        }
+    };
+#endif
+
+#if defined(VECTORS_HPP_AVX)
+    template <>
+    struct vec_ops<double, 4>
+    {
+        static void add(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_add_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void sub(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_sub_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void mul(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void div(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_div_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void min(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_min_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void max(const double *a, const double *b, double *r) { _mm256_storeu_pd(r, _mm256_max_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b))); }
+        static void scale(const double *a, double s, double *r) { _mm256_storeu_pd(r, _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_set1_pd(s))); }
+        static double dot(const double *a, const double *b)
+        {
+            __m256d products = _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b));
+            __m128d sums = _mm_add_pd(_mm256_castpd256_pd128(products), _mm256_extractf128_pd(products, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(sums, _mm_unpackhi_pd(sums, sums)));
+        }
+    };
+#endif
+}
+
+/* N-component vector over any arithmetic Scalar. */
+template <typename Scalar, unsigned Size>
+class VecN
+{
+public:
+    typedef Scalar scalar_type;
+    typedef typename detail::c_vector_of<Scalar, Size>::type c_type;
+    typedef detail::vec_ops<Scalar, Size> ops;
+    Scalar components[Size];
+
+    VecN() {}
+    explicit VecN(Scalar s) { for (unsigned i = 0; i < Size; i++) components[i] = s; }
+    VecN(Scalar x_, Scalar y_)
+    {
+        static_assert(Size == 2, "VecN(x, y) requires 2 components");
+        components[0] = x_; components[1] = y_;
+    }
+    VecN(Scalar x_, Scalar y_, Scalar z_)
+    {
+        static_assert(Size == 3, "VecN(x, y, z) requires 3 components");
+        components[0] = x_; components[1] = y_; components[2] = z_;
+    }
+    VecN(Scalar x_, Scalar y_, Scalar z_, Scalar w_)
+    {
+        static_assert(Size == 4, "VecN(x, y, z, w) requires 4 components");
+        components[0] = x_; components[1] = y_; components[2] = z_; components[3] = w_;
+    }
+    VecN(const c_type &v) { for (unsigned i = 0; i < Size; i++) components[i] = v.components[i]; }
+
+    /* Per-component conversion from another scalar type. */
+    template <typename Other>
+    explicit VecN(const VecN<Other, Size> &other) { for (unsigned i = 0; i < Size; i++) components[i] = static_cast<Scalar>(other.components[i]); }
+
+    operator c_type() const { c_type v; for (unsigned i = 0; i < Size; i++) v.components[i] = components[i]; return v; }
+
+    Scalar &operator[](unsigned i) { return components[i]; }
+    Scalar operator[](unsigned i) const { return components[i]; }
+    Scalar &x() { return components[0]; }
+    Scalar &y() { return components[1]; }
+    Scalar &z() { static_assert(Size >= 3, "z() requires 3 or more components"); return components[2]; }
+    Scalar &w() { static_assert(Size >= 4, "w() requires 4 or more components"); return components[3]; }
+    Scalar x() const { return components[0]; }
+    Scalar y() const { return components[1]; }
+    Scalar z() const { static_assert(Size >= 3, "z() requires 3 or more components"); return components[2]; }
+    Scalar w() const { static_assert(Size >= 4, "w() requires 4 or more components"); return components[3]; }
+
+    VecN &operator+=(const VecN &o) { ops::add(components, o.components, components); return *this; }
+    VecN &operator-=(const VecN &o) { ops::sub(components, o.components, components); return *this; }
+    VecN &operator*=(const VecN &o) { ops::mul(components, o.components, components); return *this; }
+    VecN &operator/=(const VecN &o) { ops::div(components, o.components, components); return *this; }
+    VecN &operator*=(Scalar s) { ops::scale(components, s, components); return *this; }
+    VecN &operator/=(Scalar s) { return *this /= VecN(s); }
+};
+
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator+(VecN<Scalar, Size> a, const VecN<Scalar, Size> &b) { return a += b; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator-(VecN<Scalar, Size> a, const VecN<Scalar, Size> &b) { return a -= b; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator*(VecN<Scalar, Size> a, const VecN<Scalar, Size> &b) { return a *= b; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator/(VecN<Scalar, Size> a, const VecN<Scalar, Size> &b) { return a /= b; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator*(VecN<Scalar, Size> a, Scalar s) { return a *= s; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator*(Scalar s, VecN<Scalar, Size> a) { return a *= s; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator/(VecN<Scalar, Size> a, Scalar s) { return a /= s; }
+template <typename Scalar, unsigned Size> inline VecN<Scalar, Size> operator-(const VecN<Scalar, Size> &a) { return VecN<Scalar, Size>(Scalar(0)) - a; }
+
+template <typename Scalar, unsigned Size>
+inline bool operator==(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b)
+{
+    for (unsigned i = 0; i < Size; i++) if (a.components[i] != b.components[i]) return false;
+    return true;
+}
+template <typename Scalar, unsigned Size>
+inline bool operator!=(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b) { return !(a == b); }
+
+/* Per-component minimum. */
+template <typename Scalar, unsigned Size>
+inline VecN<Scalar, Size> min(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b)
+{
+    VecN<Scalar, Size> r;
+    detail::vec_ops<Scalar, Size>::min(a.components, b.components, r.components);
+    return r;
+}
+
+/* Per-component maximum. */
+template <typename Scalar, unsigned Size>
+inline VecN<Scalar, Size> max(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b)
+{
+    VecN<Scalar, Size> r;
+    detail::vec_ops<Scalar, Size>::max(a.components, b.components, r.components);
+    return r;
+}
+
+/* Per-component clamp into (minimum..maximum). */
+template <typename Scalar, unsigned Size>
+inline VecN<Scalar, Size> clamp(const VecN<Scalar, Size> &v, const VecN<Scalar, Size> &minimum, const VecN<Scalar, Size> &maximum)
+{
+    return min(max(v, minimum), maximum);
+}
+
+/* Dot product. */
+template <typename Scalar, unsigned Size>
+inline Scalar dot(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b)
+{
+    return detail::vec_ops<Scalar, Size>::dot(a.components, b.components);
+}
+
+/* 3-component cross product. */
+template <typename Scalar>
+inline VecN<Scalar, 3> cross(const VecN<Scalar, 3> &a, const VecN<Scalar, 3> &b)
+{
+    return VecN<Scalar, 3>(
+        a[1] * b[2] - b[1] * a[2],
+        a[2] * b[0] - b[2] * a[0],
+        a[0] * b[1] - b[0] * a[1]);
+}
+
+/* Linear interpolation. */
+template <typename Scalar, unsigned Size>
+inline VecN<Scalar, Size> lerp(const VecN<Scalar, Size> &a, const VecN<Scalar, Size> &b, Scalar t)
+{
+    return a + (b - a) * t;
+}
+
+/* Magnitude/Length */
+template <typename Scalar, unsigned Size>
+inline Scalar magnitude(const VecN<Scalar, Size> &a)
+{
+    return detail::square_root(dot(a, a));
+}
+
+/* Unit-vector */
+template <typename Scalar, unsigned Size>
+inline VecN<Scalar, Size> normalize(const VecN<Scalar, Size> &a)
+{
+    return a / magnitude(a);
+}
+
+typedef VecN<float, 2> Vec2f;
+typedef VecN<float, 3> Vec3f;
+typedef VecN<float, 4> Vec4f;
+typedef VecN<double, 2> Vec2d;
+typedef VecN<double, 3> Vec3d;
+typedef VecN<double, 4> Vec4d;
+typedef VecN<i32, 2> Vec2i;
+typedef VecN<i32, 3> Vec3i;
+typedef VecN<i32, 4> Vec4i;
+
+/* Rows x Columns matrix over any arithmetic Scalar, stored row-major. */
+template <typename Scalar, unsigned Rows, unsigned Columns>
+class MatMxN
+{
+public:
+    typedef Scalar scalar_type;
+    typedef typename detail::c_matrix_of<Scalar, Rows, Columns>::type c_type;
+    Scalar data[Rows * Columns];
+
+    MatMxN() {}
+    explicit MatMxN(Scalar s) { for (unsigned i = 0; i < Rows * Columns; i++) data[i] = s; }
+    MatMxN(const c_type &m) { for (unsigned i = 0; i < Rows * Columns; i++) data[i] = m.data[i]; }
+
+    template <typename Other>
+    explicit MatMxN(const MatMxN<Other, Rows, Columns> &other) { for (unsigned i = 0; i < Rows * Columns; i++) data[i] = static_cast<Scalar>(other.data[i]); }
+
+    static MatMxN identity()
+    {
+        static_assert(Rows == Columns, "identity() requires a square matrix");
+        MatMxN r(Scalar(0));
+        for (unsigned i = 0; i < Rows; i++) r(i, i) = Scalar(1);
+        return r;
+    }
+
+    operator c_type() const { c_type m; for (unsigned i = 0; i < Rows * Columns; i++) m.data[i] = data[i]; return m; }
+
+    Scalar &operator()(unsigned row, unsigned column) { return data[row * Columns + column]; }
+    Scalar operator()(unsigned row, unsigned column) const { return data[row * Columns + column]; }
+
+    VecN<Scalar, Columns> row(unsigned r) const { VecN<Scalar, Columns> v; for (unsigned c = 0; c < Columns; c++) v[c] = (*this)(r, c); return v; }
+    VecN<Scalar, Rows> column(unsigned c) const { VecN<Scalar, Rows> v; for (unsigned r = 0; r < Rows; r++) v[r] = (*this)(r, c); return v; }
+
+    MatMxN<Scalar, Columns, Rows> transposed() const
+    {
+        MatMxN<Scalar, Columns, Rows> t;
+        for (unsigned r = 0; r < Rows; r++) for (unsigned c = 0; c < Columns; c++) t(c, r) = (*this)(r, c);
+        return t;
+    }
+
+    MatMxN &operator+=(const MatMxN &o) { detail::vec_ops<Scalar, Rows * Columns>::add(data, o.data, data); return *this; }
+    MatMxN &operator-=(const MatMxN &o) { detail::vec_ops<Scalar, Rows * Columns>::sub(data, o.data, data); return *this; }
+    MatMxN &operator*=(Scalar s) { detail::vec_ops<Scalar, Rows * Columns>::scale(data, s, data); return *this; }
+};
+
+template <typename Scalar, unsigned Rows, unsigned Columns>
+inline MatMxN<Scalar, Rows, Columns> operator+(MatMxN<Scalar, Rows, Columns> a, const MatMxN<Scalar, Rows, Columns> &b) { return a += b; }
+template <typename Scalar, unsigned Rows, unsigned Columns>
+inline MatMxN<Scalar, Rows, Columns> operator-(MatMxN<Scalar, Rows, Columns> a, const MatMxN<Scalar, Rows, Columns> &b) { return a -= b; }
+template <typename Scalar, unsigned Rows, unsigned Columns>
+inline MatMxN<Scalar, Rows, Columns> operator*(MatMxN<Scalar, Rows, Columns> a, Scalar s) { return a *= s; }
+
+/* Matrix product. */
+template <typename Scalar, unsigned Rows, unsigned Inner, unsigned Columns>
+inline MatMxN<Scalar, Rows, Columns> operator*(const MatMxN<Scalar, Rows, Inner> &a, const MatMxN<Scalar, Inner, Columns> &b)
+{
+    MatMxN<Scalar, Rows, Columns> r;
+    detail::mat_ops<Scalar, Rows, Inner, Columns>::mul(a.data, b.data, r.data);
+    return r;
+}
+
+/* Matrix-vector product. */
+template <typename Scalar, unsigned Rows, unsigned Columns>
+inline VecN<Scalar, Rows> operator*(const MatMxN<Scalar, Rows, Columns> &m, const VecN<Scalar, Columns> &v)
+{
+    VecN<Scalar, Rows> r;
+    detail::mat_ops<Scalar, Rows, Columns, Columns>::mul_vec(m.data, v.components, r.components);
+    return r;
+}
+
+typedef MatMxN<float, 2, 2> Mat2f;
+typedef MatMxN<float, 3, 3> Mat3f;
+typedef MatMxN<float, 4, 4> Mat4f;
+typedef MatMxN<double, 3, 3> Mat3d;
+typedef MatMxN<double, 4, 4> Mat4d;
+
+} /* namespace vectors */
+
+#endif /* VECTORS_HPP */
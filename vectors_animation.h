@@ -0,0 +1,284 @@
+#if !defined(VECTORS_ANIMATION_H)
+#define VECTORS_ANIMATION_H
+
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Animation tracks - keyframes sorted by time, stored compressed:
+       vec3 (translation, scale)   3 x u16 per key, quantized to the track's
+                                   bounding box (minimum + key * step)
+       quaternion (rotation)       3 x u16 per key, "smallest three": the
+                                   largest component is dropped and rebuilt
+                                   from the unit length, the other three keep
+                                   15 bits each and the high bits of the first
+                                   two words hold the dropped index
+   That is 6 bytes per key instead of 12 or 16. Key times are one real per
+   key. Every sampler takes a cursor (the key span used last time) so
+   forward or backward playback finds its span in O(1); jumps fall back to a
+   binary search. Keep one cursor per track and zero it for a new clip.
+   ------------------------------------------------------------------------- */
+
+typedef struct anim_track_vec3
+{
+    u32 key_count;
+    const real *times;
+    const u16 *keys;    /* 3 per key */
+    vec3 minimum;
+    vec3 step;          /* (maximum - minimum) / 65535 */
+} anim_track_vec3;
+
+typedef struct anim_track_quat
+{
+    u32 key_count;
+    const real *times;
+    const u16 *keys;    /* 3 per key */
+} anim_track_quat;
+
+/* The three tracks of one bone and their cursors. */
+typedef struct anim_bone_track
+{
+    anim_track_vec3 translation;
+    anim_track_quat rotation;
+    anim_track_vec3 scale;
+} anim_bone_track;
+
+typedef struct anim_bone_cursor
+{
+    u32 translation;
+    u32 rotation;
+    u32 scale;
+} anim_bone_cursor;
+
+/* ---- compression ---- */
+
+/* Quantize `count` vec3 keys into `keys` (3 * count entries) and set the track's minimum and step. Does nothing
+   for an empty array. */
+static void anim_compress_vec3_array(const vec3 *values, u32 count, u16 *keys, anim_track_vec3 *track)
+{
+    vec3 minimum, maximum, inverse_step;
+    u32 i, c;
+    if (count == 0)
+    {
+        return;
+    }
+    minimum = values[0];
+    maximum = values[0];
+    for (i = 1; i < count; i++)
+    {
+        minimum = vec3_min(minimum, values[i]);
+        maximum = vec3_max(maximum, values[i]);
+    }
+    track->minimum = minimum;
+    track->step = vec3_mul_scalar(vec3_sub(maximum, minimum), 1.0f / 65535.0f);
+    for (c = 0; c < 3; c++)
+    {
+        inverse_step.components[c] = track->step.components[c] > 0.0f ? 1.0f / track->step.components[c] : 0.0f;
+    }
+    for (i = 0; i < count; i++)
+    {
+        vec3 scaled = vec3_mul(vec3_sub(values[i], minimum), inverse_step);
+        for (c = 0; c < 3; c++)
+        {
+            real key = scaled.components[c] + 0.5f;
+            keys[i * 3 + c] = (u16)(key < 65535.0f ? key : 65535.0f);
+        }
+    }
+}
+
+/* Pack a unit quaternion into three words (smallest three, 15 bits per component). */
+static void anim_compress_quat(vec4 rotation, u16 *key)
+{
+    u32 largest = 0;
+    u32 i, written = 0;
+    u16 packed[3];
+    for (i = 1; i < 4; i++)
+    {
+        largest = real_abs(rotation.components[i]) > real_abs(rotation.components[largest]) ? i : largest;
+    }
+    if (rotation.components[largest] < 0.0f)
+    {
+        rotation = vec4_negate(rotation);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            real scaled = (rotation.components[i] + 0.70710678f) * (32767.0f / 1.41421356f) + 0.5f;
+            scaled = scaled < 0.0f ? 0.0f : (scaled > 32767.0f ? 32767.0f : scaled);
+            packed[written++] = (u16)scaled;
+        }
+    }
+    key[0] = (u16)(packed[0] | ((largest >> 1) << 15));
+    key[1] = (u16)(packed[1] | ((largest & 1) << 15));
+    key[2] = packed[2];
+}
+
+/* Unpack a quaternion written by anim_compress_quat. */
+static vec4 anim_decompress_quat(const u16 *key)
+{
+    u32 largest = ((u32)(key[0] >> 15) << 1) | (u32)(key[1] >> 15);
+    real a = (real)(key[0] & 0x7fff) * (1.41421356f / 32767.0f) - 0.70710678f;
+    real b = (real)(key[1] & 0x7fff) * (1.41421356f / 32767.0f) - 0.70710678f;
+    real c = (real)(key[2] & 0x7fff) * (1.41421356f / 32767.0f) - 0.70710678f;
+    real remainder = 1.0f - a * a - b * b - c * c;
+    real dropped = remainder > 0.0f ? real_sqrt(remainder) : 0.0f;
+    vec4 rotation;
+    switch (largest)
+    {
+        case 0:  rotation = vec4_init_from_4(dropped, a, b, c); break;
+        case 1:  rotation = vec4_init_from_4(a, dropped, b, c); break;
+        case 2:  rotation = vec4_init_from_4(a, b, dropped, c); break;
+        default: rotation = vec4_init_from_4(a, b, c, dropped); break;
+    }
+    return rotation;
+}
+
+/* Compress `count` quaternion keys into `keys` (3 * count entries). */
+static void anim_compress_quat_array(const vec4 *values, u32 count, u16 *keys)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        anim_compress_quat(values[i], keys + i * 3);
+    }
+}
+
+/* Unpack one quantized vec3 key. */
+static vec3 anim_decompress_vec3(const anim_track_vec3 *track, u32 key)
+{
+    const u16 *packed = track->keys + key * 3;
+    vec3 quantized = vec3_init_from_3((real)packed[0], (real)packed[1], (real)packed[2]);
+    return vec3_fma(quantized, track->step, track->minimum);
+}
+
+/* ---- sampling ---- */
+
+/* Key span [key, key + 1] containing `time` (clamped to the track), starting from the cursor, which is
+   updated. Returns the interpolation factor within the span. */
+static real anim_seek(const real *times, u32 key_count, u32 *cursor, real time)
+{
+    u32 last = key_count > 1 ? key_count - 2 : 0;
+    u32 key = *cursor <= last ? *cursor : last;
+    real span;
+    real factor;
+
+    if (key_count < 2)
+    {
+        *cursor = 0;
+        return 0.0f;
+    }
+    if (time < times[key])
+    {
+        /* Reverse playback steps back one span; anything else searches. */
+        if (key > 0 && time >= times[key - 1])
+        {
+            key--;
+        }
+        else
+        {
+            u32 low = 0, high = key;
+            while (low < high)
+            {
+                u32 middle = (low + high + 1) / 2;
+                if (times[middle] <= time)
+                {
+                    low = middle;
+                }
+                else
+                {
+                    high = middle - 1;
+                }
+            }
+            key = low;
+        }
+    }
+    else if (key < last && time >= times[key + 1])
+    {
+        /* Forward playback usually lands in the next span. */
+        if (key + 1 == last || time < times[key + 2])
+        {
+            key++;
+        }
+        else
+        {
+            u32 low = key + 1, high = last;
+            while (low < high)
+            {
+                u32 middle = (low + high + 1) / 2;
+                if (times[middle] <= time)
+                {
+                    low = middle;
+                }
+                else
+                {
+                    high = middle - 1;
+                }
+            }
+            key = low;
+        }
+    }
+    *cursor = key;
+
+    span = times[key + 1] - times[key];
+    factor = span > 0.0f ? (time - times[key]) / span : 0.0f;
+    return factor < 0.0f ? 0.0f : (factor > 1.0f ? 1.0f : factor);
+}
+
+/* Sample a vec3 track at `time` (linear interpolation). An empty track samples as the zero vector. */
+static vec3 anim_sample_vec3(const anim_track_vec3 *track, u32 *cursor, real time)
+{
+    real factor = anim_seek(track->times, track->key_count, cursor, time);
+    if (track->key_count == 0)
+    {
+        return vec3_init_from_1(0.0f);
+    }
+    if (track->key_count < 2)
+    {
+        return anim_decompress_vec3(track, 0);
+    }
+    return vec3_lerp(anim_decompress_vec3(track, *cursor), anim_decompress_vec3(track, *cursor + 1), factor);
+}
+
+/* Sample a rotation track at `time` with quat_nlerp, or quat_slerp when `use_slerp` is set. An empty
+   track samples as the identity. */
+static vec4 anim_sample_quat(const anim_track_quat *track, u32 *cursor, real time, bool use_slerp)
+{
+    real factor = anim_seek(track->times, track->key_count, cursor, time);
+    vec4 start, end;
+    if (track->key_count == 0)
+    {
+        return quat_identity();
+    }
+    if (track->key_count < 2)
+    {
+        return anim_decompress_quat(track->keys);
+    }
+    start = anim_decompress_quat(track->keys + *cursor * 3);
+    end = anim_decompress_quat(track->keys + *cursor * 3 + 3);
+    return use_slerp ? quat_slerp(start, end, factor) : quat_nlerp(start, end, factor);
+}
+
+/* Sample `count` bones at one time into separate translation, rotation and scale arrays. Bone tracks are
+   visited in order, so a skeleton's tracks should be laid out contiguously. nlerp is the usual choice at
+   typical key densities; use_slerp gives constant angular velocity between keys. */
+static void anim_sample_bones(const anim_bone_track *tracks, anim_bone_cursor *cursors, u32 count, real time, bool use_slerp,
+                              vec3 *translation, vec4 *rotation, vec3 *scale)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        translation[i] = anim_sample_vec3(&tracks[i].translation, &cursors[i].translation, time);
+        rotation[i] = anim_sample_quat(&tracks[i].rotation, &cursors[i].rotation, time, use_slerp);
+        scale[i] = anim_sample_vec3(&tracks[i].scale, &cursors[i].scale, time);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_ANIMATION_H */
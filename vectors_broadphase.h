@@ -0,0 +1,258 @@
+#if !defined(VECTORS_BROADPHASE_H)
+#define VECTORS_BROADPHASE_H
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_BROADPHASE_NO_SIMD  test overlaps with scalar code even when
+                                SSE or AVX is available.
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_BROADPHASE_NO_SIMD)
+    #if defined(__AVX__)
+        #include <immintrin.h>
+        #define VECTORS_BROADPHASE_AVX 1
+        #define VECTORS_BROADPHASE_SSE 1
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #include <xmmintrin.h>
+        #define VECTORS_BROADPHASE_SSE 1
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Sweep and prune - boxes kept sorted by their minimum on one axis. Each
+   update re-sorts with an insertion sort, which is close to O(n) when the
+   boxes moved a little since the last frame. The sweep then only compares a
+   box with the boxes that start before it ends on the sort axis; the other
+   two axes are tested from structure-of-arrays copies eight at a time with
+   AVX and four at a time with SSE, as compare-and-movemask bit masks.
+   All buffers are owned by the caller, `count` entries each:
+       order           body index of each sorted slot
+       sweep_min       sort-axis minimum, in sorted order
+       sweep_max       sort-axis maximum, in sorted order
+       cross_min[2]    minimum on the two other axes, in sorted order
+       cross_max[2]    maximum on the two other axes, in sorted order
+   ------------------------------------------------------------------------- */
+
+typedef struct sweep_prune
+{
+    u32 count;
+    u32 axis;
+    u32 *order;
+    real *sweep_min;
+    real *sweep_max;
+    real *cross_min[2];
+    real *cross_max[2];
+} sweep_prune;
+
+/* One overlapping pair, a < b. */
+typedef struct sweep_prune_pair
+{
+    u32 a;
+    u32 b;
+} sweep_prune_pair;
+
+/* Axis-aligned box around `count` points (count > 0), e.g. the vertices of one body. */
+static void sweep_prune_bounds(const vec3 *points, u32 count, vec3 *minimum, vec3 *maximum)
+{
+    vec3 lower = points[0];
+    vec3 upper = points[0];
+    u32 i;
+    for (i = 1; i < count; i++)
+    {
+        lower = vec3_min(lower, points[i]);
+        upper = vec3_max(upper, points[i]);
+    }
+    *minimum = lower;
+    *maximum = upper;
+}
+
+/* Axis along which the box centers spread the most - the best sort axis (fewest false candidates). */
+static u32 sweep_prune_choose_axis(const vec3 *minimum, const vec3 *maximum, u32 count)
+{
+    vec3 sum = vec3_init_from_1(0.0f);
+    vec3 sum_squared = vec3_init_from_1(0.0f);
+    vec3 variance;
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec3 center = vec3_add(minimum[i], maximum[i]);
+        sum = vec3_add(sum, center);
+        sum_squared = vec3_fma(center, center, sum_squared);
+    }
+    variance = vec3_sub(vec3_mul_scalar(sum_squared, (real)count), vec3_mul(sum, sum));
+    if (variance.components[0] >= variance.components[1] && variance.components[0] >= variance.components[2])
+    {
+        return 0;
+    }
+    return variance.components[1] >= variance.components[2] ? 1 : 2;
+}
+
+/* Reset to `count` bodies in index order, sorted along `axis` by the next sweep_prune_update. */
+static void sweep_prune_init(sweep_prune *sap, u32 count, u32 axis)
+{
+    u32 i;
+    sap->count = count;
+    sap->axis = axis;
+    for (i = 0; i < count; i++)
+    {
+        sap->order[i] = i;
+    }
+}
+
+/* Refresh the sorted bounds from the bodies' current boxes and restore the order by insertion sort. */
+static void sweep_prune_update(sweep_prune *sap, const vec3 *minimum, const vec3 *maximum)
+{
+    u32 axis = sap->axis;
+    u32 axis1 = axis == 0 ? 1 : 0;
+    u32 axis2 = axis == 2 ? 1 : 2;
+    u32 *order = sap->order;
+    real *sweep_min = sap->sweep_min;
+    u32 i;
+
+    for (i = 0; i < sap->count; i++)
+    {
+        sweep_min[i] = minimum[order[i]].components[axis];
+    }
+    for (i = 1; i < sap->count; i++)
+    {
+        real key = sweep_min[i];
+        u32 body = order[i];
+        u32 slot = i;
+        while (slot > 0 && sweep_min[slot - 1] > key)
+        {
+            sweep_min[slot] = sweep_min[slot - 1];
+            order[slot] = order[slot - 1];
+            slot--;
+        }
+        sweep_min[slot] = key;
+        order[slot] = body;
+    }
+    for (i = 0; i < sap->count; i++)
+    {
+        u32 body = order[i];
+        sap->sweep_max[i] = maximum[body].components[axis];
+        sap->cross_min[0][i] = minimum[body].components[axis1];
+        sap->cross_max[0][i] = maximum[body].components[axis1];
+        sap->cross_min[1][i] = minimum[body].components[axis2];
+        sap->cross_max[1][i] = maximum[body].components[axis2];
+    }
+}
+
+/* Append a pair if there is room; returns the new total. */
+static u32 sweep_prune_emit(sweep_prune_pair *pairs, u32 total, u32 capacity, u32 body0, u32 body1)
+{
+    if (total < capacity)
+    {
+        pairs[total].a = body0 < body1 ? body0 : body1;
+        pairs[total].b = body0 < body1 ? body1 : body0;
+    }
+    return total + 1;
+}
+
+/* Overlap mask of sorted slot `slot` against slots [first, first + 4), bit n for slot first + n. */
+static u32 sweep_prune_mask4(const sweep_prune *sap, u32 slot, u32 first)
+{
+    const real *min0 = sap->cross_min[0] + first, *max0 = sap->cross_max[0] + first;
+    const real *min1 = sap->cross_min[1] + first, *max1 = sap->cross_max[1] + first;
+    real lower0 = sap->cross_min[0][slot], upper0 = sap->cross_max[0][slot];
+    real lower1 = sap->cross_min[1][slot], upper1 = sap->cross_max[1][slot];
+#if defined(VECTORS_BROADPHASE_SSE)
+    __m128 hit = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(min0), _mm_set1_ps(upper0)),
+                            _mm_cmpge_ps(_mm_loadu_ps(max0), _mm_set1_ps(lower0)));
+    hit = _mm_and_ps(hit, _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(min1), _mm_set1_ps(upper1)),
+                                     _mm_cmpge_ps(_mm_loadu_ps(max1), _mm_set1_ps(lower1))));
+    return (u32)_mm_movemask_ps(hit);
+#else
+    u32 mask = 0;
+    u32 n;
+    for (n = 0; n < 4; n++)
+    {
+        u32 hit = (u32)(min0[n] <= upper0) & (u32)(max0[n] >= lower0) & (u32)(min1[n] <= upper1) & (u32)(max1[n] >= lower1);
+        mask |= hit << n;
+    }
+    return mask;
+#endif
+}
+
+/* Overlap mask of sorted slot `slot` against slots [first, first + 8), bit n for slot first + n. */
+static u32 sweep_prune_mask8(const sweep_prune *sap, u32 slot, u32 first)
+{
+#if defined(VECTORS_BROADPHASE_AVX)
+    __m256 hit = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(sap->cross_min[0] + first), _mm256_set1_ps(sap->cross_max[0][slot]), _CMP_LE_OQ),
+                               _mm256_cmp_ps(_mm256_loadu_ps(sap->cross_max[0] + first), _mm256_set1_ps(sap->cross_min[0][slot]), _CMP_GE_OQ));
+    hit = _mm256_and_ps(hit, _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(sap->cross_min[1] + first), _mm256_set1_ps(sap->cross_max[1][slot]), _CMP_LE_OQ),
+                                           _mm256_cmp_ps(_mm256_loadu_ps(sap->cross_max[1] + first), _mm256_set1_ps(sap->cross_min[1][slot]), _CMP_GE_OQ)));
+    return (u32)_mm256_movemask_ps(hit);
+#else
+    return sweep_prune_mask4(sap, slot, first) | (sweep_prune_mask4(sap, slot, first + 4) << 4);
+#endif
+}
+
+/* Emit the pairs of `slot` with the slots from `first` flagged in `mask`; returns the new total. */
+static u32 sweep_prune_emit_mask(const sweep_prune *sap, sweep_prune_pair *pairs, u32 total, u32 capacity,
+                                 u32 slot, u32 first, u32 mask)
+{
+    while (mask != 0)
+    {
+        u32 n = 0;
+        while (!(mask & (1u << n)))
+        {
+            n++;
+        }
+        mask &= mask - 1;
+        total = sweep_prune_emit(pairs, total, capacity, sap->order[slot], sap->order[first + n]);
+    }
+    return total;
+}
+
+/* Write every overlapping pair (boxes touching counts as overlap) to `pairs`, at most `capacity`, as body
+   indices. Returns the total number of pairs - if it exceeds capacity the output is truncated and the call
+   should be repeated with a larger buffer. */
+static u32 sweep_prune_pairs(const sweep_prune *sap, sweep_prune_pair *pairs, u32 capacity)
+{
+    u32 total = 0;
+    u32 slot;
+    for (slot = 0; slot < sap->count; slot++)
+    {
+        real reach = sap->sweep_max[slot];
+        u32 first = slot + 1;
+        u32 end = first;
+        u32 other;
+
+        /* Candidates are the run of boxes starting before this one ends ... */
+        while (end < sap->count && sap->sweep_min[end] <= reach)
+        {
+            end++;
+        }
+        /* ... tested eight and then four at a time on the other two axes, then one at a time for the tail. */
+        for (other = first; other + 8 <= end; other += 8)
+        {
+            total = sweep_prune_emit_mask(sap, pairs, total, capacity, slot, other, sweep_prune_mask8(sap, slot, other));
+        }
+        if (other + 4 <= end)
+        {
+            total = sweep_prune_emit_mask(sap, pairs, total, capacity, slot, other, sweep_prune_mask4(sap, slot, other));
+            other += 4;
+        }
+        for (; other < end; other++)
+        {
+            if (sap->cross_min[0][other] <= sap->cross_max[0][slot] && sap->cross_max[0][other] >= sap->cross_min[0][slot] &&
+                sap->cross_min[1][other] <= sap->cross_max[1][slot] && sap->cross_max[1][other] >= sap->cross_min[1][slot])
+            {
+                total = sweep_prune_emit(pairs, total, capacity, sap->order[slot], sap->order[other]);
+            }
+        }
+    }
+    return total;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_BROADPHASE_H */
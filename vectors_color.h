@@ -0,0 +1,365 @@
+#if !defined(VECTORS_COLOR_H)
+#define VECTORS_COLOR_H
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_COLOR_NO_SSE2       pack RGBA8 with scalar code even when SSE2
+                                is available.
+    VECTORS_COLOR_LUT_BITS      index bits of the linear -> sRGB8 table
+                                (table has 1 << bits entries).
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_COLOR_LUT_BITS)
+    #define VECTORS_COLOR_LUT_BITS 12
+#endif
+#define VECTORS_COLOR_LUT_SIZE (1 << VECTORS_COLOR_LUT_BITS)
+
+#if !defined(VECTORS_COLOR_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define VECTORS_COLOR_SSE2 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Colors are vec4 (r, g, b, a) in [0, 1]; alpha is always linear and is
+   passed through untouched by the transfer functions. Packed colors are
+   u32 with r in the lowest byte (bytes R, G, B, A in memory on
+   little-endian machines).
+   ------------------------------------------------------------------------- */
+
+/* ---- sRGB transfer function ---- */
+
+/* Exact sRGB -> linear for one channel (reference; uses real_pow). */
+static real color_srgb_to_linear(real value)
+{
+    return value <= 0.04045f ? value * (1.0f / 12.92f) : real_pow((value + 0.055f) * (1.0f / 1.055f), 2.4f);
+}
+
+/* Exact linear -> sRGB for one channel (reference; uses real_pow). */
+static real color_linear_to_srgb(real value)
+{
+    return value <= 0.0031308f ? value * 12.92f : 1.055f * real_pow(value, 1.0f / 2.4f) - 0.055f;
+}
+
+/* Polynomial sRGB -> linear, input in [0, 1]; within 0.002 of the exact curve. */
+static real color_srgb_to_linear_fast(real value)
+{
+    return value * (value * (value * 0.305306011f + 0.682171111f) + 0.012522878f);
+}
+
+/* Approximate linear -> sRGB from three square roots (exact linear toe), input in [0, 1]; within 0.001 of the exact curve. */
+static real color_linear_to_srgb_fast(real value)
+{
+    real s1 = real_sqrt(value);
+    real s2 = real_sqrt(s1);
+    real s3 = real_sqrt(s2);
+    real curve = 0.662002687f * s1 + 0.684122060f * s2 - 0.323583601f * s3 - 0.0225411470f * value;
+    return value <= 0.0031308f ? value * 12.92f : curve;
+}
+
+/* sRGB -> linear of the color channels, exact. */
+static vec4 vec4_srgb_to_linear(vec4 color)
+{
+    vec4 result = color;
+    result.color.r = color_srgb_to_linear(color.color.r);
+    result.color.g = color_srgb_to_linear(color.color.g);
+    result.color.b = color_srgb_to_linear(color.color.b);
+    return result;
+}
+
+/* linear -> sRGB of the color channels, exact. */
+static vec4 vec4_linear_to_srgb(vec4 color)
+{
+    vec4 result = color;
+    result.color.r = color_linear_to_srgb(color.color.r);
+    result.color.g = color_linear_to_srgb(color.color.g);
+    result.color.b = color_linear_to_srgb(color.color.b);
+    return result;
+}
+
+/* sRGB -> linear of `count` colors with the polynomial (dst may alias src). */
+static void vec4_srgb_to_linear_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec4 color = src[i];
+        dst[i].color.r = color_srgb_to_linear_fast(color.color.r);
+        dst[i].color.g = color_srgb_to_linear_fast(color.color.g);
+        dst[i].color.b = color_srgb_to_linear_fast(color.color.b);
+        dst[i].color.a = color.color.a;
+    }
+}
+
+/* linear -> sRGB of `count` colors with the square-root approximation (dst may alias src). */
+static void vec4_linear_to_srgb_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec4 color = vec4_clamp_scalar(src[i], 0.0f, 1.0f);
+        dst[i].color.r = color_linear_to_srgb_fast(color.color.r);
+        dst[i].color.g = color_linear_to_srgb_fast(color.color.g);
+        dst[i].color.b = color_linear_to_srgb_fast(color.color.b);
+        dst[i].color.a = color.color.a;
+    }
+}
+
+/* ---- lookup tables ---- */
+
+/* Fill the 256-entry sRGB8 -> linear table (exact). */
+static void color_build_srgb8_to_linear_table(real *table)
+{
+    u32 i;
+    for (i = 0; i < 256; i++)
+    {
+        table[i] = color_srgb_to_linear((real)i * (1.0f / 255.0f));
+    }
+}
+
+/* Fill the VECTORS_COLOR_LUT_SIZE-entry linear -> sRGB8 table, sampled at bucket centres. */
+static void color_build_linear_to_srgb8_table(u8 *table)
+{
+    u32 i;
+    for (i = 0; i < VECTORS_COLOR_LUT_SIZE; i++)
+    {
+        real linear = ((real)i + 0.5f) * (1.0f / (real)VECTORS_COLOR_LUT_SIZE);
+        table[i] = (u8)(color_linear_to_srgb(linear) * 255.0f + 0.5f);
+    }
+}
+
+/* Table index of a linear channel, clamped to [0, 1]. */
+static u32 color_lut_index(real value)
+{
+    real scaled = value * (real)VECTORS_COLOR_LUT_SIZE;
+    scaled = scaled > 0.0f ? scaled : 0.0f;
+    scaled = scaled < (real)(VECTORS_COLOR_LUT_SIZE - 1) ? scaled : (real)(VECTORS_COLOR_LUT_SIZE - 1);
+    return (u32)scaled;
+}
+
+/* ---- RGBA8 packing ---- */
+
+/* Pack a [0, 1] color to RGBA8 (clamped, rounded). */
+static u32 color_pack_rgba8(vec4 color)
+{
+    vec4 scaled = vec4_add_scalar(vec4_mul_scalar(vec4_clamp_scalar(color, 0.0f, 1.0f), 255.0f), 0.5f);
+    return (u32)scaled.color.r | ((u32)scaled.color.g << 8) | ((u32)scaled.color.b << 16) | ((u32)scaled.color.a << 24);
+}
+
+/* Unpack RGBA8 to a [0, 1] color. */
+static vec4 color_unpack_rgba8(u32 packed)
+{
+    vec4 color = vec4_init_from_4((real)(packed & 0xff), (real)((packed >> 8) & 0xff), (real)((packed >> 16) & 0xff), (real)(packed >> 24));
+    return vec4_mul_scalar(color, 1.0f / 255.0f);
+}
+
+/* Pack `count` colors to RGBA8, four at a time with SSE2 when available (same rounding as color_pack_rgba8). */
+static void color_pack_rgba8_array(const vec4 *src, u32 *dst, u32 count)
+{
+    u32 i = 0;
+#if defined(VECTORS_COLOR_SSE2)
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 scale = _mm_set1_ps(255.0f);
+    __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= count; i += 4)
+    {
+        const real *lanes = src[i].components;
+        __m128i c0 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(lanes), zero), one), scale), half));
+        __m128i c1 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(lanes + 4), zero), one), scale), half));
+        __m128i c2 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(lanes + 8), zero), one), scale), half));
+        __m128i c3 = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(lanes + 12), zero), one), scale), half));
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+        _mm_storeu_si128((__m128i *)(dst + i), packed);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = color_pack_rgba8(src[i]);
+    }
+}
+
+/* Unpack `count` RGBA8 colors. */
+static void color_unpack_rgba8_array(const u32 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = color_unpack_rgba8(src[i]);
+    }
+}
+
+/* Decode `count` sRGB8 pixels to linear colors through a color_build_srgb8_to_linear_table table. */
+static void color_srgb8_to_linear_array(const u32 *src, const real *table, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        u32 packed = src[i];
+        dst[i] = vec4_init_from_4(table[packed & 0xff], table[(packed >> 8) & 0xff], table[(packed >> 16) & 0xff],
+                                  (real)(packed >> 24) * (1.0f / 255.0f));
+    }
+}
+
+/* Encode `count` linear colors to sRGB8 pixels through a color_build_linear_to_srgb8_table table. */
+static void color_linear_to_srgb8_array(const vec4 *src, const u8 *table, u32 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec4 color = src[i];
+        real alpha = real_min(real_max(color.color.a, 0.0f), 1.0f);
+        dst[i] = (u32)table[color_lut_index(color.color.r)] | ((u32)table[color_lut_index(color.color.g)] << 8) |
+                 ((u32)table[color_lut_index(color.color.b)] << 16) | ((u32)(alpha * 255.0f + 0.5f) << 24);
+    }
+}
+
+/* ---- premultiplied alpha ---- */
+
+/* Multiply the color channels by alpha. */
+static vec4 vec4_premultiply(vec4 color)
+{
+    vec4 result = vec4_mul_scalar(color, color.color.a);
+    result.color.a = color.color.a;
+    return result;
+}
+
+/* Divide the color channels by alpha (fully transparent colors become zero). */
+static vec4 vec4_unpremultiply(vec4 color)
+{
+    real inverse_alpha = color.color.a > 0.0f ? 1.0f / color.color.a : 0.0f;
+    vec4 result = vec4_mul_scalar(color, inverse_alpha);
+    result.color.a = color.color.a;
+    return result;
+}
+
+/* Premultiply `count` colors (dst may alias src). */
+static void vec4_premultiply_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_premultiply(src[i]);
+    }
+}
+
+/* Unpremultiply `count` colors (dst may alias src). */
+static void vec4_unpremultiply_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_unpremultiply(src[i]);
+    }
+}
+
+/* ---- HSV and YCoCg ---- */
+
+/* RGB -> HSV with hue, saturation and value in [0, 1] (hue 0 for greys). */
+static vec4 vec4_rgb_to_hsv(vec4 color)
+{
+    real r = color.color.r, g = color.color.g, b = color.color.b;
+    real maximum = real_max(r, real_max(g, b));
+    real minimum = real_min(r, real_min(g, b));
+    real chroma = maximum - minimum;
+    real hue = 0.0f;
+    if (chroma > 0.0f)
+    {
+        if (maximum == r)
+        {
+            hue = (g - b) / chroma;
+            hue = hue < 0.0f ? hue + 6.0f : hue;
+        }
+        else if (maximum == g)
+        {
+            hue = (b - r) / chroma + 2.0f;
+        }
+        else
+        {
+            hue = (r - g) / chroma + 4.0f;
+        }
+    }
+    return vec4_init_from_4(hue * (1.0f / 6.0f), maximum > 0.0f ? chroma / maximum : 0.0f, maximum, color.color.a);
+}
+
+/* HSV -> RGB, the inverse of vec4_rgb_to_hsv (hue wraps). */
+static vec4 vec4_hsv_to_rgb(vec4 hsv)
+{
+    real hue = (hsv.components[0] - real_floor(hsv.components[0])) * 6.0f;
+    real saturation = hsv.components[1];
+    real value = hsv.components[2];
+    /* Piecewise-linear hue ramp of each channel, then blended towards white by (1 - saturation). */
+    real r = real_abs(hue - 3.0f) - 1.0f;
+    real g = 2.0f - real_abs(hue - 2.0f);
+    real b = 2.0f - real_abs(hue - 4.0f);
+    r = r < 0.0f ? 0.0f : (r > 1.0f ? 1.0f : r);
+    g = g < 0.0f ? 0.0f : (g > 1.0f ? 1.0f : g);
+    b = b < 0.0f ? 0.0f : (b > 1.0f ? 1.0f : b);
+    return vec4_init_from_4(value * (1.0f - saturation * (1.0f - r)), value * (1.0f - saturation * (1.0f - g)),
+                            value * (1.0f - saturation * (1.0f - b)), hsv.components[3]);
+}
+
+/* RGB -> YCoCg as (Y, Co, Cg, a); Co and Cg are in [-0.5, 0.5]. */
+static vec4 vec4_rgb_to_ycocg(vec4 color)
+{
+    real r = color.color.r, g = color.color.g, b = color.color.b;
+    return vec4_init_from_4(0.25f * r + 0.5f * g + 0.25f * b, 0.5f * r - 0.5f * b, -0.25f * r + 0.5f * g - 0.25f * b, color.color.a);
+}
+
+/* YCoCg -> RGB, the inverse of vec4_rgb_to_ycocg. */
+static vec4 vec4_ycocg_to_rgb(vec4 ycocg)
+{
+    real y = ycocg.components[0], co = ycocg.components[1], cg = ycocg.components[2];
+    real base = y - cg;
+    return vec4_init_from_4(base + co, y + cg, base - co, ycocg.components[3]);
+}
+
+/* RGB -> HSV of `count` colors (dst may alias src). */
+static void vec4_rgb_to_hsv_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_rgb_to_hsv(src[i]);
+    }
+}
+
+/* HSV -> RGB of `count` colors (dst may alias src). */
+static void vec4_hsv_to_rgb_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_hsv_to_rgb(src[i]);
+    }
+}
+
+/* RGB -> YCoCg of `count` colors (dst may alias src). */
+static void vec4_rgb_to_ycocg_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_rgb_to_ycocg(src[i]);
+    }
+}
+
+/* YCoCg -> RGB of `count` colors (dst may alias src). */
+static void vec4_ycocg_to_rgb_array(const vec4 *src, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_ycocg_to_rgb(src[i]);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_COLOR_H */
@@ -0,0 +1,439 @@
+#if !defined(VECTORS_DELAUNAY_H)
+#define VECTORS_DELAUNAY_H
+
+#include "vectors_morton.h"
+#include "vectors_predicates.h"
+
+#define DELAUNAY_NONE 0xffffffffu
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Delaunay triangulation of vec2 points and its Voronoi dual.
+   Triangles are stored as half-edges, three per triangle: half-edge e
+   starts at vertex triangles[e], belongs to triangle e / 3, continues with
+   delaunay_next(e) and is paired with halfedges[e] on the neighboring
+   triangle (DELAUNAY_NONE on the convex hull). Triangles are
+   counter-clockwise.
+   Points are inserted one at a time (Bowyer-Watson, on the exact
+   predicates of "vectors_predicates.h") in the order from
+   delaunay_insertion_order: random rounds of doubling size (BRIO), each
+   sorted along a Hilbert curve, so every point lands next to the previous
+   one and the walk to it stays short.
+   ------------------------------------------------------------------------- */
+
+typedef struct delaunay
+{
+    u32 triangle_count;
+    u32 *triangles;     /* 3 per triangle: vertex indices */
+    u32 *halfedges;     /* 3 per triangle: opposite half-edge or DELAUNAY_NONE */
+} delaunay;
+
+static u32 delaunay_next(u32 edge)
+{
+    return edge % 3 == 2 ? edge - 2 : edge + 1;
+}
+
+static u32 delaunay_previous(u32 edge)
+{
+    return edge % 3 == 0 ? edge + 2 : edge - 1;
+}
+
+/* ---- insertion order ---- */
+
+/* Position of a 16-bit cell along a Hilbert curve over the 65536 x 65536 grid. */
+static u32 delaunay_hilbert(u32 x, u32 y)
+{
+    u32 index = 0;
+    u32 side;
+    for (side = 1u << 15; side > 0; side >>= 1)
+    {
+        u32 rx = (x & side) ? 1u : 0u;
+        u32 ry = (y & side) ? 1u : 0u;
+        index += side * side * ((3u * rx) ^ ry);
+        /* Rotate the quadrant so the curve continues into the next level. */
+        if (ry == 0)
+        {
+            u32 swap;
+            if (rx == 1)
+            {
+                x = 0xffffu - x;
+                y = 0xffffu - y;
+            }
+            swap = x;
+            x = y;
+            y = swap;
+        }
+    }
+    return index;
+}
+
+/* Insertion order for `count` points: round (a random geometric level, so rounds double in size) in the
+   high half of each key, Hilbert position in the low half, radix sorted with morton_sort63.
+   `keys` and `scratch_keys` hold `count` u64s, `scratch` `count` u32s; `order` receives the point indices. */
+static void delaunay_insertion_order(const vec2 *points, u32 count, u64 *keys, u64 *scratch_keys, u32 *scratch, u32 *order)
+{
+    vec2 minimum, maximum;
+    real scale_x, scale_y;
+    u32 i;
+    if (count == 0)
+    {
+        return;
+    }
+    minimum = points[0];
+    maximum = points[0];
+    for (i = 1; i < count; i++)
+    {
+        minimum = vec2_min(minimum, points[i]);
+        maximum = vec2_max(maximum, points[i]);
+    }
+    scale_x = maximum.position.x > minimum.position.x ? 65535.0f / (maximum.position.x - minimum.position.x) : 0.0f;
+    scale_y = maximum.position.y > minimum.position.y ? 65535.0f / (maximum.position.y - minimum.position.y) : 0.0f;
+    for (i = 0; i < count; i++)
+    {
+        u32 x = (u32)((points[i].position.x - minimum.position.x) * scale_x);
+        u32 y = (u32)((points[i].position.y - minimum.position.y) * scale_y);
+        u32 hash = i * 0x9e3779b9u;
+        u32 level = 0;
+        hash ^= hash >> 16;
+        hash *= 0x7feb352du;
+        hash ^= hash >> 15;
+        hash *= 0x846ca68bu;
+        hash ^= hash >> 16;
+        /* Level k with probability 2^-(k+1); the rare high levels are inserted first. */
+        while ((hash & 1u) && level < 31)
+        {
+            hash >>= 1;
+            level++;
+        }
+        keys[i] = ((u64)(31 - level) << 32) | (u64)delaunay_hilbert(x < 65535 ? x : 65535, y < 65535 ? y : 65535);
+    }
+    morton_sort63(keys, order, scratch_keys, scratch, count);
+}
+
+/* ---- triangulation ---- */
+
+/* Whether inserting `point` invalidates triangle `triangle`: the point is strictly inside its circumcircle,
+   or for a ghost triangle (one edge of the hull and the vertex at infinity, `infinite`) strictly outside
+   that hull edge or inside the edge itself. */
+static bool delaunay_conflict(const delaunay *mesh, const vec2 *points, u32 infinite, u32 triangle, vec2 point)
+{
+    const u32 *corner = mesh->triangles + triangle * 3;
+    u32 k;
+    for (k = 0; k < 3; k++)
+    {
+        if (corner[k] == infinite)
+        {
+            vec2 u = points[corner[(k + 1) % 3]];
+            vec2 v = points[corner[(k + 2) % 3]];
+            i32 side = predicate_orient2d(u, v, point);
+            if (side != 0)
+            {
+                return side > 0;
+            }
+            return u.position.x != v.position.x
+                ? (point.position.x > real_min(u.position.x, v.position.x) && point.position.x < real_max(u.position.x, v.position.x))
+                : (point.position.y > real_min(u.position.y, v.position.y) && point.position.y < real_max(u.position.y, v.position.y));
+        }
+    }
+    return predicate_incircle(points[corner[0]], points[corner[1]], points[corner[2]], point) > 0;
+}
+
+/* Replace the boundary edges in `boundary` (3 per edge: start, end, outer half-edge) by a fan of triangles
+   to `apex`, reusing the slots in `slots` first. Returns the first new triangle, or DELAUNAY_NONE when
+   `capacity` triangles would be exceeded. */
+static u32 delaunay_fan(delaunay *mesh, const u32 *boundary, u32 boundary_count, u32 apex, const u32 *slots, u32 slot_count,
+                        u32 *vertex_edge, u32 capacity)
+{
+    u32 first = DELAUNAY_NONE;
+    u32 i;
+    for (i = 0; i < boundary_count; i++)
+    {
+        u32 start = boundary[i * 3 + 0], end = boundary[i * 3 + 1], outer = boundary[i * 3 + 2];
+        u32 triangle;
+        if (i < slot_count)
+        {
+            triangle = slots[i];
+        }
+        else if (mesh->triangle_count < capacity)
+        {
+            triangle = mesh->triangle_count++;
+        }
+        else
+        {
+            return DELAUNAY_NONE;
+        }
+        mesh->triangles[triangle * 3 + 0] = start;
+        mesh->triangles[triangle * 3 + 1] = end;
+        mesh->triangles[triangle * 3 + 2] = apex;
+        mesh->halfedges[triangle * 3 + 0] = outer;
+        mesh->halfedges[outer] = triangle * 3;
+        vertex_edge[start] = triangle * 3 + 2;
+        first = i == 0 ? triangle : first;
+    }
+    /* Side edges: end -> apex pairs with apex -> end of the fan triangle that starts at `end`. */
+    for (i = 0; i < boundary_count; i++)
+    {
+        u32 edge = vertex_edge[boundary[i * 3 + 0]] - 1;
+        u32 partner = vertex_edge[boundary[i * 3 + 1]];
+        mesh->halfedges[edge] = partner;
+        mesh->halfedges[partner] = edge;
+    }
+    return first;
+}
+
+/* Delaunay triangulation of `count` points, inserted in `order` (delaunay_insertion_order, or NULL for index
+   order). mesh->triangles and mesh->halfedges must hold 6 * count entries each; `scratch` holds 8 * count + 4
+   u32s. Duplicate points are left out. Returns the triangle count, 0 when all points are collinear (or fewer
+   than three). */
+static u32 delaunay_build(delaunay *mesh, const vec2 *points, u32 count, const u32 *order, u32 *scratch)
+{
+    u32 capacity = 2 * count;
+    u32 infinite = count;
+    u32 *stamps = scratch;                      /* capacity: cavity marks, then the compaction map */
+    u32 *cavity = scratch + capacity;           /* capacity */
+    u32 *vertex_edge = scratch + 2 * capacity;  /* count + 1 */
+    u32 *boundary = vertex_edge + count + 1;    /* 3 * (count + 1) */
+    u32 first[3];
+    u32 last, stamp = 0, found = 1, i, k;
+
+    mesh->triangle_count = 0;
+    if (count < 3)
+    {
+        return 0;
+    }
+
+    /* The first point, the next distinct one, and the next one off their line form the first triangle. */
+    first[0] = order ? order[0] : 0;
+    for (i = 1; i < count && found < 3; i++)
+    {
+        u32 index = order ? order[i] : i;
+        if (found == 1 && vec2_eq(points[index], points[first[0]]) != MASK_01)
+        {
+            first[found++] = index;
+        }
+        else if (found == 2 && predicate_orient2d(points[first[0]], points[first[1]], points[index]) != 0)
+        {
+            first[found++] = index;
+        }
+    }
+    if (found < 3)
+    {
+        return 0;
+    }
+    if (predicate_orient2d(points[first[0]], points[first[1]], points[first[2]]) < 0)
+    {
+        u32 swap = first[1];
+        first[1] = first[2];
+        first[2] = swap;
+    }
+    for (k = 0; k < 3; k++)
+    {
+        mesh->triangles[k] = first[k];
+        boundary[k * 3 + 0] = first[(k + 1) % 3];
+        boundary[k * 3 + 1] = first[k];
+        boundary[k * 3 + 2] = k;
+    }
+    mesh->triangle_count = 1;
+    delaunay_fan(mesh, boundary, 3, infinite, NULL, 0, vertex_edge, capacity);
+    for (i = 0; i < capacity; i++)
+    {
+        stamps[i] = 0;
+    }
+    last = 0;
+
+    for (i = 0; i < count; i++)
+    {
+        u32 index = order ? order[i] : i;
+        vec2 point = points[index];
+        u32 triangle = last;
+        u32 cavity_count = 1, boundary_count = 0, created, c;
+        bool duplicate = BOOL(0);
+
+        /* Walk towards the point until it lies in the closed triangle, or beyond the hull (a ghost). */
+        for (;;)
+        {
+            const u32 *corner = mesh->triangles + triangle * 3;
+            u32 crossed = DELAUNAY_NONE;
+            if (corner[0] == infinite || corner[1] == infinite || corner[2] == infinite)
+            {
+                break;
+            }
+            for (k = 0; k < 3 && crossed == DELAUNAY_NONE; k++)
+            {
+                if (predicate_orient2d(points[corner[k]], points[corner[(k + 1) % 3]], point) < 0)
+                {
+                    crossed = mesh->halfedges[triangle * 3 + k];
+                }
+            }
+            if (crossed == DELAUNAY_NONE)
+            {
+                for (k = 0; k < 3; k++)
+                {
+                    duplicate = duplicate || vec2_eq(points[corner[k]], point) == MASK_01;
+                }
+                break;
+            }
+            triangle = crossed / 3;
+        }
+        if (duplicate)
+        {
+            continue;
+        }
+
+        /* Cavity: the connected triangles in conflict with the point; stamp + 1 marks those that are not. */
+        stamp += 2;
+        cavity[0] = triangle;
+        stamps[triangle] = stamp;
+        for (c = 0; c < cavity_count; c++)
+        {
+            u32 current = cavity[c];
+            for (k = 0; k < 3; k++)
+            {
+                u32 edge = current * 3 + k;
+                u32 outer = mesh->halfedges[edge];
+                u32 neighbor = outer / 3;
+                if (stamps[neighbor] != stamp)
+                {
+                    if (stamps[neighbor] != stamp + 1 && delaunay_conflict(mesh, points, infinite, neighbor, point))
+                    {
+                        stamps[neighbor] = stamp;
+                        cavity[cavity_count++] = neighbor;
+                    }
+                    else
+                    {
+                        stamps[neighbor] = stamp + 1;
+                        boundary[boundary_count * 3 + 0] = mesh->triangles[edge];
+                        boundary[boundary_count * 3 + 1] = mesh->triangles[delaunay_next(edge)];
+                        boundary[boundary_count * 3 + 2] = outer;
+                        boundary_count++;
+                    }
+                }
+            }
+        }
+
+        created = delaunay_fan(mesh, boundary, boundary_count, index, cavity, cavity_count, vertex_edge, capacity);
+        if (created == DELAUNAY_NONE)
+        {
+            mesh->triangle_count = 0;
+            return 0;
+        }
+        /* Continue the next walk from a finite triangle of the new fan. */
+        for (c = 0; c < boundary_count; c++)
+        {
+            if (boundary[c * 3 + 0] != infinite && boundary[c * 3 + 1] != infinite)
+            {
+                last = mesh->halfedges[boundary[c * 3 + 2]] / 3;
+                break;
+            }
+        }
+    }
+
+    /* Drop the ghost triangles: number the finite ones, then move them down and remap their half-edges. */
+    {
+        u32 finite = 0;
+        u32 total = mesh->triangle_count;
+        for (i = 0; i < total; i++)
+        {
+            const u32 *corner = mesh->triangles + i * 3;
+            stamps[i] = (corner[0] == infinite || corner[1] == infinite || corner[2] == infinite) ? DELAUNAY_NONE : finite++;
+        }
+        for (i = 0; i < total; i++)
+        {
+            u32 target = stamps[i];
+            if (target == DELAUNAY_NONE)
+            {
+                continue;
+            }
+            for (k = 0; k < 3; k++)
+            {
+                u32 outer = mesh->halfedges[i * 3 + k];
+                u32 neighbor = stamps[outer / 3];
+                mesh->triangles[target * 3 + k] = mesh->triangles[i * 3 + k];
+                mesh->halfedges[target * 3 + k] = neighbor == DELAUNAY_NONE ? DELAUNAY_NONE : neighbor * 3 + outer % 3;
+            }
+        }
+        mesh->triangle_count = finite;
+    }
+    return mesh->triangle_count;
+}
+
+/* ---- Voronoi dual ---- */
+
+/* Circumcenter of every triangle - the Voronoi vertices (triangle_count entries). */
+static void delaunay_circumcenters(const delaunay *mesh, const vec2 *points, vec2 *centers)
+{
+    u32 i;
+    for (i = 0; i < mesh->triangle_count; i++)
+    {
+        vec2 a = points[mesh->triangles[i * 3 + 0]];
+        vec2 b = vec2_sub(points[mesh->triangles[i * 3 + 1]], a);
+        vec2 c = vec2_sub(points[mesh->triangles[i * 3 + 2]], a);
+        real b_length = vec2_dot(b, b);
+        real c_length = vec2_dot(c, c);
+        real scale = 0.5f / vec2_perp(b, c);
+        centers[i] = vec2_init_from_2(a.position.x + (c.position.y * b_length - b.position.y * c_length) * scale,
+                                      a.position.y + (b.position.x * c_length - c.position.x * b_length) * scale);
+    }
+}
+
+/* One outgoing half-edge per vertex (`count` entries), DELAUNAY_NONE for points left out. Hull vertices get
+   their outgoing hull edge, so a walk around the vertex from it sees every triangle. */
+static void delaunay_vertex_edges(const delaunay *mesh, u32 count, u32 *edges)
+{
+    u32 e;
+    for (e = 0; e < count; e++)
+    {
+        edges[e] = DELAUNAY_NONE;
+    }
+    for (e = 0; e < mesh->triangle_count * 3; e++)
+    {
+        u32 vertex = mesh->triangles[e];
+        if (edges[vertex] == DELAUNAY_NONE || mesh->halfedges[e] == DELAUNAY_NONE)
+        {
+            edges[vertex] = e;
+        }
+    }
+}
+
+/* Voronoi cell of the vertex that half-edge `edge` leaves (from delaunay_vertex_edges): the triangles around
+   the vertex counter-clockwise, whose circumcenters are the cell's corners. Writes up to `capacity` triangles
+   and returns their full count. Hull vertices have open cells: `*hull_edge` receives the hull edge entering
+   the vertex and the cell extends to infinity from the first center along delaunay_hull_normal(`edge`) and
+   from the last along delaunay_hull_normal(`*hull_edge`). Closed cells set it to DELAUNAY_NONE. */
+static u32 delaunay_voronoi_cell(const delaunay *mesh, u32 edge, u32 *cell, u32 capacity, u32 *hull_edge)
+{
+    u32 current = edge;
+    u32 written = 0;
+    *hull_edge = DELAUNAY_NONE;
+    do
+    {
+        u32 incoming = delaunay_previous(current);
+        if (written < capacity)
+        {
+            cell[written] = current / 3;
+        }
+        written++;
+        current = mesh->halfedges[incoming];
+        if (current == DELAUNAY_NONE)
+        {
+            *hull_edge = incoming;
+        }
+    } while (current != DELAUNAY_NONE && current != edge);
+    return written;
+}
+
+/* Outward normal (not normalized) of hull half-edge `edge`, the direction of its Voronoi ray. */
+static vec2 delaunay_hull_normal(const delaunay *mesh, const vec2 *points, u32 edge)
+{
+    vec2 direction = vec2_sub(points[mesh->triangles[delaunay_next(edge)]], points[mesh->triangles[edge]]);
+    return vec2_init_from_2(direction.position.y, -direction.position.x);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_DELAUNAY_H */
@@ -0,0 +1,782 @@
+#if !defined(VECTORS_GJK_H)
+#define VECTORS_GJK_H
+
+#include <stddef.h>
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_GJK_MAX_ITERATIONS  GJK iteration cap.
+    VECTORS_GJK_TOLERANCE       relative GJK convergence tolerance.
+    VECTORS_EPA_MAX_FACES       EPA polytope face capacity (on the stack).
+    VECTORS_EPA_TOLERANCE       absolute EPA convergence tolerance.
+    VECTORS_EPA_MAX_ITERATIONS  EPA expansion cap.
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_GJK_MAX_ITERATIONS)
+    #define VECTORS_GJK_MAX_ITERATIONS 64
+#endif
+#if !defined(VECTORS_GJK_TOLERANCE)
+    #define VECTORS_GJK_TOLERANCE ((real)1e-5)
+#endif
+#if !defined(VECTORS_EPA_MAX_FACES)
+    #define VECTORS_EPA_MAX_FACES 128
+#endif
+#if !defined(VECTORS_EPA_TOLERANCE)
+    #define VECTORS_EPA_TOLERANCE ((real)1e-4)
+#endif
+#if !defined(VECTORS_EPA_MAX_ITERATIONS)
+    #define VECTORS_EPA_MAX_ITERATIONS 64
+#endif
+#define VECTORS_EPA_MAX_VERTICES (VECTORS_EPA_MAX_FACES / 2 + 2)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Support functions - the furthest point of a convex shape along a
+   direction (which need not be normalized). All shapes are in world space.
+   ------------------------------------------------------------------------- */
+
+typedef vec3 (*gjk_support)(const void *shape, vec3 direction);
+
+/* A convex shape: its support function plus the data it reads. */
+typedef struct gjk_shape
+{
+    gjk_support support;
+    const void *data;
+} gjk_shape;
+
+typedef struct gjk_sphere
+{
+    vec3 center;
+    real radius;
+} gjk_sphere;
+
+typedef struct gjk_box
+{
+    vec3 center;
+    vec3 half_extents;
+    vec4 orientation;   /* unit quaternion */
+} gjk_box;
+
+typedef struct gjk_capsule
+{
+    vec3 start;
+    vec3 end;
+    real radius;
+} gjk_capsule;
+
+typedef struct gjk_hull
+{
+    const vec3 *points;
+    u32 count;
+} gjk_hull;
+
+/* Offset `radius` along a direction, or zero when the direction vanishes. */
+static vec3 gjk_radius_offset(vec3 direction, real radius)
+{
+    real length_squared = vec3_dot(direction, direction);
+    if (length_squared <= 0.0f)
+    {
+        return vec3_init_from_1(0.0f);
+    }
+    return vec3_mul_scalar(direction, radius / real_sqrt(length_squared));
+}
+
+/* Support function of a gjk_sphere. */
+static vec3 gjk_support_sphere(const void *shape, vec3 direction)
+{
+    const gjk_sphere *sphere = (const gjk_sphere *)shape;
+    return vec3_add(sphere->center, gjk_radius_offset(direction, sphere->radius));
+}
+
+/* Support function of an oriented gjk_box. */
+static vec3 gjk_support_box(const void *shape, vec3 direction)
+{
+    const gjk_box *box = (const gjk_box *)shape;
+    vec3 local = quat_rotate_vec3(quat_conjugate(box->orientation), direction);
+    vec3 corner;
+    corner.components[0] = local.components[0] >= 0.0f ? box->half_extents.components[0] : -box->half_extents.components[0];
+    corner.components[1] = local.components[1] >= 0.0f ? box->half_extents.components[1] : -box->half_extents.components[1];
+    corner.components[2] = local.components[2] >= 0.0f ? box->half_extents.components[2] : -box->half_extents.components[2];
+    return vec3_add(box->center, quat_rotate_vec3(box->orientation, corner));
+}
+
+/* Support function of a gjk_capsule. */
+static vec3 gjk_support_capsule(const void *shape, vec3 direction)
+{
+    const gjk_capsule *capsule = (const gjk_capsule *)shape;
+    vec3 tip = vec3_dot(capsule->start, direction) >= vec3_dot(capsule->end, direction) ? capsule->start : capsule->end;
+    return vec3_add(tip, gjk_radius_offset(direction, capsule->radius));
+}
+
+/* Support function of a gjk_hull (point cloud; interior points are harmless). An empty hull is the origin. */
+static vec3 gjk_support_hull(const void *shape, vec3 direction)
+{
+    const gjk_hull *hull = (const gjk_hull *)shape;
+    u32 best = 0;
+    real best_dot;
+    u32 i;
+    if (hull->count == 0)
+    {
+        return vec3_init_from_1(0.0f);
+    }
+    best_dot = vec3_dot(hull->points[0], direction);
+    for (i = 1; i < hull->count; i++)
+    {
+        real candidate = vec3_dot(hull->points[i], direction);
+        best = candidate > best_dot ? i : best;
+        best_dot = candidate > best_dot ? candidate : best_dot;
+    }
+    return hull->points[best];
+}
+
+/* -------------------------------------------------------------------------
+   GJK - distance between two convex shapes via the Minkowski difference
+   A - B. The simplex doubles as the warm-start cache: keep one per pair,
+   zero its count for a new pair, and the next query starts from the
+   previous frame's support directions instead of from scratch.
+   ------------------------------------------------------------------------- */
+
+typedef struct gjk_vertex
+{
+    vec3 direction;     /* search direction that produced this vertex */
+    vec3 support_a;
+    vec3 support_b;
+    vec3 point;         /* support_a - support_b */
+    real weight;        /* barycentric weight of the closest point */
+} gjk_vertex;
+
+typedef struct gjk_simplex
+{
+    gjk_vertex vertices[4];
+    u32 count;
+} gjk_simplex;
+
+typedef struct gjk_result
+{
+    bool intersecting;
+    real distance;      /* 0 when intersecting */
+    vec3 point_a;       /* closest points (meaningful when not intersecting) */
+    vec3 point_b;
+    u32 iterations;
+} gjk_result;
+
+/* Support vertex of A - B along a direction. */
+static gjk_vertex gjk_support_vertex(const gjk_shape *a, const gjk_shape *b, vec3 direction)
+{
+    gjk_vertex vertex;
+    vertex.direction = direction;
+    vertex.support_a = a->support(a->data, direction);
+    vertex.support_b = b->support(b->data, vec3_negate(direction));
+    vertex.point = vec3_sub(vertex.support_a, vertex.support_b);
+    vertex.weight = 0.0f;
+    return vertex;
+}
+
+/* Keep up to three vertices of the simplex (by index) with the given barycentric weights. */
+static void gjk_simplex_reduce(gjk_simplex *simplex, u32 count, u32 i0, u32 i1, u32 i2, real w0, real w1, real w2)
+{
+    gjk_vertex v0 = simplex->vertices[i0], v1 = simplex->vertices[i1], v2 = simplex->vertices[i2];
+    v0.weight = w0;
+    v1.weight = w1;
+    v2.weight = w2;
+    simplex->vertices[0] = v0;
+    simplex->vertices[1] = v1;
+    simplex->vertices[2] = v2;
+    simplex->count = count;
+}
+
+/* Closest point of segment (i0, i1) to the origin; reduces the simplex to the supporting feature. */
+static void gjk_solve_segment(gjk_simplex *simplex, u32 i0, u32 i1)
+{
+    vec3 a = simplex->vertices[i0].point;
+    vec3 edge = vec3_sub(simplex->vertices[i1].point, a);
+    real along = -vec3_dot(a, edge);
+    real length_squared = vec3_dot(edge, edge);
+    if (along <= 0.0f || length_squared <= 0.0f)
+    {
+        gjk_simplex_reduce(simplex, 1, i0, i0, i0, 1.0f, 0.0f, 0.0f);
+    }
+    else if (along >= length_squared)
+    {
+        gjk_simplex_reduce(simplex, 1, i1, i1, i1, 1.0f, 0.0f, 0.0f);
+    }
+    else
+    {
+        real t = along / length_squared;
+        gjk_simplex_reduce(simplex, 2, i0, i1, i1, 1.0f - t, t, 0.0f);
+    }
+}
+
+/* Closest point of triangle (i0, i1, i2) to the origin (Voronoi region walk); reduces the simplex. */
+static void gjk_solve_triangle(gjk_simplex *simplex, u32 i0, u32 i1, u32 i2)
+{
+    vec3 a = simplex->vertices[i0].point;
+    vec3 b = simplex->vertices[i1].point;
+    vec3 c = simplex->vertices[i2].point;
+    vec3 ab = vec3_sub(b, a), ac = vec3_sub(c, a);
+    real d1 = -vec3_dot(ab, a), d2 = -vec3_dot(ac, a);
+    real d3 = -vec3_dot(ab, b), d4 = -vec3_dot(ac, b);
+    real d5 = -vec3_dot(ab, c), d6 = -vec3_dot(ac, c);
+    real va = d3 * d6 - d5 * d4;
+    real vb = d5 * d2 - d1 * d6;
+    real vc = d1 * d4 - d3 * d2;
+    real denominator;
+
+    if (d1 <= 0.0f && d2 <= 0.0f)
+    {
+        gjk_simplex_reduce(simplex, 1, i0, i0, i0, 1.0f, 0.0f, 0.0f);
+    }
+    else if (d3 >= 0.0f && d4 <= d3)
+    {
+        gjk_simplex_reduce(simplex, 1, i1, i1, i1, 1.0f, 0.0f, 0.0f);
+    }
+    else if (d6 >= 0.0f && d5 <= d6)
+    {
+        gjk_simplex_reduce(simplex, 1, i2, i2, i2, 1.0f, 0.0f, 0.0f);
+    }
+    else if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+    {
+        real t = d1 / (d1 - d3);
+        gjk_simplex_reduce(simplex, 2, i0, i1, i1, 1.0f - t, t, 0.0f);
+    }
+    else if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+    {
+        real t = d2 / (d2 - d6);
+        gjk_simplex_reduce(simplex, 2, i0, i2, i2, 1.0f - t, t, 0.0f);
+    }
+    else if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+    {
+        real t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        gjk_simplex_reduce(simplex, 2, i1, i2, i2, 1.0f - t, t, 0.0f);
+    }
+    else
+    {
+        real v, w;
+        denominator = va + vb + vc;
+        if (denominator <= 0.0f)
+        {
+            /* Degenerate (collinear) triangle: fall back to its longest edge. */
+            gjk_solve_segment(simplex, i0, vec3_dot(ab, ab) >= vec3_dot(ac, ac) ? i1 : i2);
+            return;
+        }
+        v = vb / denominator;
+        w = vc / denominator;
+        gjk_simplex_reduce(simplex, 3, i0, i1, i2, 1.0f - v - w, v, w);
+    }
+}
+
+/* Point of the simplex closest to the origin, from the current barycentric weights. */
+static vec3 gjk_simplex_closest(const gjk_simplex *simplex)
+{
+    vec3 closest = vec3_init_from_1(0.0f);
+    u32 i;
+    for (i = 0; i < simplex->count; i++)
+    {
+        closest = vec3_fma(simplex->vertices[i].point, vec3_init_from_1(simplex->vertices[i].weight), closest);
+    }
+    return closest;
+}
+
+/* Closest feature of the tetrahedron to the origin; returns true if the origin is inside (simplex kept). */
+static bool gjk_solve_tetrahedron(gjk_simplex *simplex)
+{
+    static const u32 faces[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+    gjk_simplex best;
+    real best_distance_squared = -1.0f;
+    u32 f;
+
+    for (f = 0; f < 4; f++)
+    {
+        vec3 a = simplex->vertices[faces[f][0]].point;
+        vec3 normal = vec3_cross(vec3_sub(simplex->vertices[faces[f][1]].point, a), vec3_sub(simplex->vertices[faces[f][2]].point, a));
+        real side_origin = -vec3_dot(a, normal);
+        real side_opposite = vec3_dot(vec3_sub(simplex->vertices[faces[f][3]].point, a), normal);
+        if (side_origin * side_opposite <= 0.0f)
+        {
+            gjk_simplex candidate = *simplex;
+            vec3 closest;
+            real distance_squared;
+            gjk_solve_triangle(&candidate, faces[f][0], faces[f][1], faces[f][2]);
+            closest = gjk_simplex_closest(&candidate);
+            distance_squared = vec3_dot(closest, closest);
+            if (best_distance_squared < 0.0f || distance_squared < best_distance_squared)
+            {
+                best = candidate;
+                best_distance_squared = distance_squared;
+            }
+        }
+    }
+    if (best_distance_squared < 0.0f)
+    {
+        return BOOL(1);
+    }
+    *simplex = best;
+    return BOOL(0);
+}
+
+/* Distance, closest points and overlap of two convex shapes. `cache` (may be NULL) seeds the search with
+   the previous result's simplex and receives the final one; on intersection it holds a simplex for EPA. */
+static gjk_result gjk_distance(const gjk_shape *a, const gjk_shape *b, gjk_simplex *cache)
+{
+    gjk_simplex simplex;
+    gjk_result result;
+    vec3 closest;
+    real distance_squared = 0.0f;
+    real previous_distance_squared = -1.0f;
+    u32 i;
+
+    simplex.count = 0;
+    if (cache != NULL)
+    {
+        for (i = 0; i < cache->count && i < 4; i++)
+        {
+            simplex.vertices[simplex.count++] = gjk_support_vertex(a, b, cache->vertices[i].direction);
+        }
+    }
+    if (simplex.count == 0)
+    {
+        simplex.vertices[0] = gjk_support_vertex(a, b, vec3_init_from_3(1.0f, 0.0f, 0.0f));
+        simplex.count = 1;
+    }
+
+    result.intersecting = BOOL(0);
+    for (result.iterations = 0; result.iterations < VECTORS_GJK_MAX_ITERATIONS; result.iterations++)
+    {
+        gjk_vertex vertex;
+        bool duplicate = BOOL(0);
+
+        switch (simplex.count)
+        {
+            case 1: simplex.vertices[0].weight = 1.0f; break;
+            case 2: gjk_solve_segment(&simplex, 0, 1); break;
+            case 3: gjk_solve_triangle(&simplex, 0, 1, 2); break;
+            default: result.intersecting = gjk_solve_tetrahedron(&simplex); break;
+        }
+        if (result.intersecting)
+        {
+            break;
+        }
+
+        closest = gjk_simplex_closest(&simplex);
+        distance_squared = vec3_dot(closest, closest);
+        if (distance_squared <= VECTORS_GJK_TOLERANCE * VECTORS_GJK_TOLERANCE)
+        {
+            result.intersecting = BOOL(1);
+            break;
+        }
+        /* No progress means we are at the closest feature (or numerically stuck on it). */
+        if (previous_distance_squared >= 0.0f && distance_squared >= previous_distance_squared)
+        {
+            break;
+        }
+        previous_distance_squared = distance_squared;
+
+        vertex = gjk_support_vertex(a, b, vec3_negate(closest));
+        if (distance_squared - vec3_dot(closest, vertex.point) <= VECTORS_GJK_TOLERANCE * distance_squared)
+        {
+            break;
+        }
+        for (i = 0; i < simplex.count; i++)
+        {
+            vec3 difference = vec3_sub(simplex.vertices[i].point, vertex.point);
+            duplicate = BOOL(duplicate || vec3_dot(difference, difference) <= 0.0f);
+        }
+        if (duplicate)
+        {
+            break;
+        }
+        simplex.vertices[simplex.count++] = vertex;
+    }
+
+    result.distance = 0.0f;
+    result.point_a = simplex.vertices[0].support_a;
+    result.point_b = simplex.vertices[0].support_b;
+    if (!result.intersecting)
+    {
+        result.point_a = vec3_init_from_1(0.0f);
+        result.point_b = vec3_init_from_1(0.0f);
+        for (i = 0; i < simplex.count; i++)
+        {
+            vec3 weight = vec3_init_from_1(simplex.vertices[i].weight);
+            result.point_a = vec3_fma(simplex.vertices[i].support_a, weight, result.point_a);
+            result.point_b = vec3_fma(simplex.vertices[i].support_b, weight, result.point_b);
+        }
+        result.distance = real_sqrt(distance_squared);
+    }
+    if (cache != NULL)
+    {
+        *cache = simplex;
+    }
+    return result;
+}
+
+/* True if two convex shapes overlap (gjk_distance without the closest points). */
+static bool gjk_intersect(const gjk_shape *a, const gjk_shape *b, gjk_simplex *cache)
+{
+    return gjk_distance(a, b, cache).intersecting;
+}
+
+/* -------------------------------------------------------------------------
+   EPA - penetration depth of two overlapping shapes, expanding the GJK
+   simplex into a polytope of A - B until its face closest to the origin
+   stops moving. The normal points from A towards B: translating B by
+   normal * depth separates the shapes.
+   ------------------------------------------------------------------------- */
+
+typedef struct epa_result
+{
+    bool valid;
+    real depth;
+    vec3 normal;
+    vec3 point_a;   /* deepest point of A inside B */
+    vec3 point_b;   /* deepest point of B inside A */
+} epa_result;
+
+typedef struct epa_face
+{
+    u32 indices[3];
+    u32 neighbors[3];   /* neighbors[k] shares edge (indices[k], indices[(k + 1) % 3]) */
+    vec3 normal;
+    real distance;
+    bool alive;
+} epa_face;
+
+/* Build an outward face of the polytope; degenerate faces are pushed out of contention. */
+static epa_face epa_make_face(const gjk_vertex *vertices, u32 i0, u32 i1, u32 i2)
+{
+    epa_face face;
+    vec3 a = vertices[i0].point;
+    vec3 normal = vec3_cross(vec3_sub(vertices[i1].point, a), vec3_sub(vertices[i2].point, a));
+    real length_squared = vec3_dot(normal, normal);
+    face.indices[0] = i0;
+    face.indices[1] = i1;
+    face.indices[2] = i2;
+    face.alive = BOOL(1);
+    if (length_squared <= 0.0f)
+    {
+        face.normal = vec3_init_from_1(0.0f);
+        face.distance = (real)3.0e38;
+        return face;
+    }
+    face.normal = vec3_mul_scalar(normal, 1.0f / real_sqrt(length_squared));
+    face.distance = vec3_dot(face.normal, a);
+    return face;
+}
+
+/* Grow a GJK simplex that stopped short (touching contact) into a tetrahedron; false if the shapes are flat. */
+static bool epa_complete_simplex(const gjk_shape *a, const gjk_shape *b, gjk_simplex *simplex)
+{
+    static const real axes[6][3] = { { 1, 0, 0 }, { -1, 0, 0 }, { 0, 1, 0 }, { 0, -1, 0 }, { 0, 0, 1 }, { 0, 0, -1 } };
+    u32 i;
+    while (simplex->count < 4)
+    {
+        bool grown = BOOL(0);
+        vec3 origin = simplex->vertices[0].point;
+        vec3 edge = simplex->count >= 2 ? vec3_sub(simplex->vertices[1].point, origin) : vec3_init_from_1(0.0f);
+        vec3 normal = simplex->count >= 3 ? vec3_cross(edge, vec3_sub(simplex->vertices[2].point, origin)) : vec3_init_from_1(0.0f);
+        for (i = 0; i < 6 && !grown; i++)
+        {
+            vec3 direction = vec3_init_from_3(axes[i][0], axes[i][1], axes[i][2]);
+            gjk_vertex vertex;
+            vec3 offset;
+            real extent;
+            if (simplex->count == 2)
+            {
+                direction = vec3_cross(edge, direction);
+            }
+            else if (simplex->count == 3)
+            {
+                direction = (i & 1) ? vec3_negate(normal) : normal;
+            }
+            if (vec3_dot(direction, direction) <= 0.0f)
+            {
+                continue;
+            }
+            vertex = gjk_support_vertex(a, b, direction);
+            offset = vec3_sub(vertex.point, origin);
+            if (simplex->count == 1)
+            {
+                extent = vec3_dot(offset, offset);
+            }
+            else if (simplex->count == 2)
+            {
+                vec3 off_line = vec3_cross(edge, offset);
+                extent = vec3_dot(off_line, off_line);
+            }
+            else
+            {
+                extent = real_abs(vec3_dot(normal, offset));
+            }
+            if (extent > VECTORS_EPA_TOLERANCE * VECTORS_EPA_TOLERANCE)
+            {
+                simplex->vertices[simplex->count++] = vertex;
+                grown = BOOL(1);
+            }
+        }
+        if (!grown)
+        {
+            return BOOL(0);
+        }
+    }
+    return BOOL(1);
+}
+
+/* Closest live face to the origin. */
+static u32 epa_closest_face(const epa_face *faces, u32 face_count)
+{
+    u32 closest = 0xffffffffu;
+    u32 i;
+    for (i = 0; i < face_count; i++)
+    {
+        if (faces[i].alive && (closest == 0xffffffffu || faces[i].distance < faces[closest].distance))
+        {
+            closest = i;
+        }
+    }
+    return closest;
+}
+
+/* Whether the horizon edges (from, to, outer face) form a single closed loop with every outer face
+   sharing its edge reversed. vertex_face is scratch: on success it maps each `from` to its edge index. */
+static bool epa_horizon_is_loop(const epa_face *faces, u32 (*horizon)[3], u32 horizon_count, u32 *vertex_face)
+{
+    u32 i, k, edge = 0;
+    for (i = 0; i < horizon_count; i++)
+    {
+        vertex_face[horizon[i][0]] = 0xffffffffu;
+    }
+    for (i = 0; i < horizon_count; i++)
+    {
+        const epa_face *outer = &faces[horizon[i][2]];
+        bool shared = BOOL(0);
+        if (vertex_face[horizon[i][0]] != 0xffffffffu)
+        {
+            return BOOL(0);
+        }
+        vertex_face[horizon[i][0]] = i;
+        for (k = 0; k < 3; k++)
+        {
+            shared = BOOL(shared || (outer->indices[k] == horizon[i][1] && outer->indices[(k + 1) % 3] == horizon[i][0]));
+        }
+        if (!shared)
+        {
+            return BOOL(0);
+        }
+    }
+    /* `from` is unique, so walking to -> from from edge 0 either closes after horizon_count steps or
+       the horizon has several loops or a dangling edge. vertex_face of a `to` that is no `from` is stale. */
+    for (i = 0; i < horizon_count; i++)
+    {
+        u32 to = horizon[edge][1];
+        edge = vertex_face[to];
+        if (edge >= horizon_count || horizon[edge][0] != to || (edge == 0) != (i + 1 == horizon_count))
+        {
+            return BOOL(0);
+        }
+    }
+    return BOOL(horizon_count >= 3);
+}
+
+/* Penetration depth, normal and deepest points of two overlapping shapes, starting from the simplex that
+   gjk_distance left in its cache. Returns valid = false if the polytope degenerates. */
+static epa_result epa_penetration(const gjk_shape *a, const gjk_shape *b, const gjk_simplex *start)
+{
+    static const u32 tetrahedron[4][3] = { { 0, 1, 2 }, { 0, 3, 1 }, { 1, 3, 2 }, { 2, 3, 0 } };
+    static const u32 tetrahedron_neighbors[4][3] = { { 1, 2, 3 }, { 3, 2, 0 }, { 1, 3, 0 }, { 2, 1, 0 } };
+    gjk_vertex vertices[VECTORS_EPA_MAX_VERTICES];
+    epa_face faces[VECTORS_EPA_MAX_FACES];
+    u32 visited[VECTORS_EPA_MAX_FACES];
+    u32 removed[VECTORS_EPA_MAX_FACES];
+    u32 horizon[VECTORS_EPA_MAX_FACES][3];     /* from, to, outer face */
+    u32 vertex_face[VECTORS_EPA_MAX_VERTICES];
+    gjk_simplex simplex = *start;
+    epa_result result;
+    u32 vertex_count, face_count, closest_face;
+    u32 iteration, i, k;
+
+    result.valid = BOOL(0);
+    result.depth = 0.0f;
+    result.normal = vec3_init_from_1(0.0f);
+    result.point_a = vec3_init_from_1(0.0f);
+    result.point_b = vec3_init_from_1(0.0f);
+    if (simplex.count == 0 || !epa_complete_simplex(a, b, &simplex))
+    {
+        return result;
+    }
+
+    /* Wind the tetrahedron so vertex 3 lies behind face 0, 1, 2; then every face below points outward. */
+    for (i = 0; i < 4; i++)
+    {
+        vertices[i] = simplex.vertices[i];
+    }
+    {
+        vec3 origin = vertices[0].point;
+        vec3 normal = vec3_cross(vec3_sub(vertices[1].point, origin), vec3_sub(vertices[2].point, origin));
+        if (vec3_dot(normal, vec3_sub(vertices[3].point, origin)) > 0.0f)
+        {
+            gjk_vertex swap = vertices[1];
+            vertices[1] = vertices[2];
+            vertices[2] = swap;
+        }
+    }
+    vertex_count = 4;
+    for (i = 0; i < 4; i++)
+    {
+        faces[i] = epa_make_face(vertices, tetrahedron[i][0], tetrahedron[i][1], tetrahedron[i][2]);
+        for (k = 0; k < 3; k++)
+        {
+            faces[i].neighbors[k] = tetrahedron_neighbors[i][k];
+        }
+        visited[i] = 0;
+    }
+    face_count = 4;
+
+    for (iteration = 1; iteration <= VECTORS_EPA_MAX_ITERATIONS; iteration++)
+    {
+        gjk_vertex vertex;
+        u32 removed_count = 1, horizon_count = 0, capacity;
+        bool overflow = BOOL(0);
+
+        closest_face = epa_closest_face(faces, face_count);
+        vertex = gjk_support_vertex(a, b, faces[closest_face].normal);
+        if (vec3_dot(vertex.point, faces[closest_face].normal) - faces[closest_face].distance <= VECTORS_EPA_TOLERANCE ||
+            vertex_count == VECTORS_EPA_MAX_VERTICES)
+        {
+            break;
+        }
+
+        /* Faces the new vertex sees, flood-filled from the closest face so the removed region stays connected.
+           Nearly coplanar neighbors are kept. Connected is not simply connected: the region can wrap around
+           kept faces, so its horizon is checked to be one loop below. */
+        removed[0] = closest_face;
+        visited[closest_face] = iteration;
+        for (i = 0; i < removed_count; i++)
+        {
+            const epa_face *face = &faces[removed[i]];
+            for (k = 0; k < 3; k++)
+            {
+                u32 neighbor = face->neighbors[k];
+                if (visited[neighbor] != iteration)
+                {
+                    const epa_face *other = &faces[neighbor];
+                    real height = vec3_dot(other->normal, vec3_sub(vertex.point, vertices[other->indices[0]].point));
+                    if (height > VECTORS_EPA_TOLERANCE * (real)0.01)
+                    {
+                        visited[neighbor] = iteration;
+                        removed[removed_count++] = neighbor;
+                    }
+                }
+            }
+        }
+
+        /* Horizon edges, bounded by the faces left after the removed ones are recycled. Every check comes
+           before touching the polytope, so stopping here leaves it intact. */
+        capacity = VECTORS_EPA_MAX_FACES - face_count + removed_count;
+        for (i = 0; i < removed_count && !overflow; i++)
+        {
+            const epa_face *face = &faces[removed[i]];
+            for (k = 0; k < 3; k++)
+            {
+                if (visited[face->neighbors[k]] != iteration)
+                {
+                    if (horizon_count == capacity)
+                    {
+                        overflow = BOOL(1);
+                        break;
+                    }
+                    horizon[horizon_count][0] = face->indices[k];
+                    horizon[horizon_count][1] = face->indices[(k + 1) % 3];
+                    horizon[horizon_count][2] = face->neighbors[k];
+                    horizon_count++;
+                }
+            }
+        }
+        if (overflow || !epa_horizon_is_loop(faces, horizon, horizon_count, vertex_face))
+        {
+            break;
+        }
+
+        /* Replace the removed faces by a fan from the horizon to the new vertex, reusing their slots. */
+        vertices[vertex_count] = vertex;
+        for (i = 0; i < horizon_count; i++)
+        {
+            u32 from = horizon[i][0], to = horizon[i][1], outer = horizon[i][2];
+            u32 slot = i < removed_count ? removed[i] : face_count++;
+            faces[slot] = epa_make_face(vertices, from, to, vertex_count);
+            faces[slot].neighbors[0] = outer;
+            for (k = 0; k < 3; k++)
+            {
+                if (faces[outer].indices[k] == to && faces[outer].indices[(k + 1) % 3] == from)
+                {
+                    faces[outer].neighbors[k] = slot;
+                }
+            }
+            visited[slot] = 0;
+            vertex_face[from] = slot;
+            horizon[i][2] = slot;
+        }
+        for (i = horizon_count; i < removed_count; i++)
+        {
+            faces[removed[i]].alive = BOOL(0);
+        }
+        for (i = 0; i < horizon_count; i++)
+        {
+            u32 face = horizon[i][2];
+            u32 next = vertex_face[horizon[i][1]];
+            faces[face].neighbors[1] = next;
+            faces[next].neighbors[2] = face;
+        }
+        vertex_count++;
+
+        /* The fan must close: each new face's next neighbor links back to it. Stop expanding otherwise;
+           the closest face below reads only live faces, never the links. */
+        for (i = 0; i < horizon_count; i++)
+        {
+            u32 face = horizon[i][2];
+            if (faces[faces[face].neighbors[1]].neighbors[2] != face)
+            {
+                break;
+            }
+        }
+        if (i < horizon_count)
+        {
+            break;
+        }
+    }
+
+    /* Project the origin onto the closest face and carry its barycentric coordinates over to A and B. */
+    closest_face = epa_closest_face(faces, face_count);
+    {
+        epa_face face = faces[closest_face];
+        vec3 point = vec3_mul_scalar(face.normal, face.distance);
+        vec3 p0 = vertices[face.indices[0]].point;
+        vec3 e1 = vec3_sub(vertices[face.indices[1]].point, p0);
+        vec3 e2 = vec3_sub(vertices[face.indices[2]].point, p0);
+        vec3 to_point = vec3_sub(point, p0);
+        real d11 = vec3_dot(e1, e1), d12 = vec3_dot(e1, e2), d22 = vec3_dot(e2, e2);
+        real dp1 = vec3_dot(to_point, e1), dp2 = vec3_dot(to_point, e2);
+        real denominator = d11 * d22 - d12 * d12;
+        real v = denominator != 0.0f ? (d22 * dp1 - d12 * dp2) / denominator : 0.0f;
+        real w = denominator != 0.0f ? (d11 * dp2 - d12 * dp1) / denominator : 0.0f;
+        real u = 1.0f - v - w;
+        result.valid = BOOL(face.distance >= 0.0f && face.distance < (real)3.0e38);
+        result.depth = face.distance;
+        result.normal = face.normal;
+        result.point_a = vec3_add(vec3_add(vec3_mul_scalar(vertices[face.indices[0]].support_a, u),
+                                           vec3_mul_scalar(vertices[face.indices[1]].support_a, v)),
+                                  vec3_mul_scalar(vertices[face.indices[2]].support_a, w));
+        result.point_b = vec3_add(vec3_add(vec3_mul_scalar(vertices[face.indices[0]].support_b, u),
+                                           vec3_mul_scalar(vertices[face.indices[1]].support_b, v)),
+                                  vec3_mul_scalar(vertices[face.indices[2]].support_b, w));
+    }
+    return result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_GJK_H */
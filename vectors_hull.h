@@ -0,0 +1,617 @@
+#if !defined(VECTORS_HULL_H)
+#define VECTORS_HULL_H
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_HULL_TOLERANCE  plane thickness relative to the point cloud's
+                            coordinate magnitude; points closer than this
+                            to a face count as inside.
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_HULL_TOLERANCE)
+    #define VECTORS_HULL_TOLERANCE ((real)1e-5)
+#endif
+
+#define HULL_NONE 0xffffffffu
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Convex hulls and oriented boxes of point clouds:
+       hull3_build     quickhull over vec3; triangles wound counter-clockwise
+                       seen from outside, with face adjacency
+       hull2_build     quickhull over vec2; hull vertices counter-clockwise
+       obb_from_points oriented box from the principal axes of the points
+   Everything works on caller-provided buffers; sizes are given with each
+   function. hull2_build drops collinear points. hull3_build skips points
+   within the tolerance of a face, but points on hull edges (or added before
+   their coplanar neighbours) stay as vertices, and coplanar regions stay
+   triangulated rather than merged, so a box face may come out as more
+   than two triangles.
+   ------------------------------------------------------------------------- */
+
+typedef struct hull3_face
+{
+    u32 indices[3];     /* counter-clockwise seen from outside */
+    u32 neighbors[3];   /* neighbors[k] shares edge (indices[k], indices[(k + 1) % 3]) */
+    vec3 normal;
+    real offset;        /* dot(normal, p) - offset is the signed distance of p */
+    u32 outside;        /* building only: farthest point of the outside set */
+    u32 visited;        /* building only: visibility search stamps */
+    u32 visible;
+    u32 flags;
+} hull3_face;
+
+typedef struct obb
+{
+    vec3 center;
+    vec3 axes[3];       /* orthonormal, right-handed, longest spread first */
+    vec3 half_extents;
+} obb;
+
+/* ---- extreme points ---- */
+
+/* Indices of the points with the smallest and largest coordinate on each axis (3 entries each).
+   Branch-free so the loop vectorizes. */
+static void hull3_extremes(const vec3 *points, u32 count, u32 *minimum, u32 *maximum)
+{
+    real low[3], high[3];
+    u32 i, c;
+    for (c = 0; c < 3; c++)
+    {
+        minimum[c] = 0;
+        maximum[c] = 0;
+        low[c] = points[0].components[c];
+        high[c] = points[0].components[c];
+    }
+    for (i = 1; i < count; i++)
+    {
+        for (c = 0; c < 3; c++)
+        {
+            real value = points[i].components[c];
+            bool below = value < low[c];
+            bool above = value > high[c];
+            minimum[c] = below ? i : minimum[c];
+            low[c] = below ? value : low[c];
+            maximum[c] = above ? i : maximum[c];
+            high[c] = above ? value : high[c];
+        }
+    }
+}
+
+/* ---- 3D quickhull ---- */
+
+#define HULL3_FACE_ALIVE  1u
+#define HULL3_FACE_QUEUED 2u
+
+/* Build state shared by the helpers below. */
+typedef struct hull3_context
+{
+    const vec3 *points;
+    hull3_face *faces;
+    u32 *point_next;    /* outside-set links */
+    u32 *pending;       /* faces with a non-empty outside set */
+    u32 pending_count;
+    real tolerance;
+} hull3_context;
+
+static real hull3_face_distance(const hull3_face *face, vec3 point)
+{
+    return vec3_dot(face->normal, point) - face->offset;
+}
+
+static void hull3_face_init(hull3_context *context, u32 face, u32 a, u32 b, u32 c)
+{
+    hull3_face *f = &context->faces[face];
+    vec3 origin = context->points[a];
+    vec3 normal = vec3_cross(vec3_sub(context->points[b], origin), vec3_sub(context->points[c], origin));
+    real length = vec3_magnitude(normal);
+    f->indices[0] = a;
+    f->indices[1] = b;
+    f->indices[2] = c;
+    f->normal = length > 0.0f ? vec3_mul_scalar(normal, 1.0f / length) : normal;
+    f->offset = vec3_dot(f->normal, origin);
+    f->outside = HULL_NONE;
+    f->visited = 0;
+    f->visible = 0;
+    f->flags = (f->flags & HULL3_FACE_QUEUED) | HULL3_FACE_ALIVE;
+}
+
+/* Put a point into the outside set of the face (of `face_ids`, every `stride`th entry) it is farthest above.
+   The farthest point of each set is kept at its head. Points inside all faces are dropped. */
+static void hull3_assign(hull3_context *context, const u32 *face_ids, u32 stride, u32 face_count, u32 point)
+{
+    real best_distance = context->tolerance;
+    u32 best = HULL_NONE;
+    hull3_face *face;
+    u32 i;
+    for (i = 0; i < face_count; i++)
+    {
+        real distance = hull3_face_distance(&context->faces[face_ids[i * stride]], context->points[point]);
+        if (distance > best_distance)
+        {
+            best_distance = distance;
+            best = face_ids[i * stride];
+        }
+    }
+    if (best == HULL_NONE)
+    {
+        return;
+    }
+    face = &context->faces[best];
+    if (face->outside == HULL_NONE)
+    {
+        context->point_next[point] = HULL_NONE;
+        face->outside = point;
+        if (!(face->flags & HULL3_FACE_QUEUED))
+        {
+            face->flags |= HULL3_FACE_QUEUED;
+            context->pending[context->pending_count++] = best;
+        }
+    }
+    else if (best_distance > hull3_face_distance(face, context->points[face->outside]))
+    {
+        context->point_next[point] = face->outside;
+        face->outside = point;
+    }
+    else
+    {
+        context->point_next[point] = context->point_next[face->outside];
+        context->point_next[face->outside] = point;
+    }
+}
+
+/* Convex hull of `count` points. `faces` holds 2 * count entries and `scratch` 9 * count u32s.
+   Returns the number of hull triangles written to the front of `faces` (neighbors index that range),
+   or 0 when the points are coplanar, fewer than four, or rounding broke the hull's topology. */
+static u32 hull3_build(const vec3 *points, u32 count, hull3_face *faces, u32 *scratch)
+{
+    static const u32 tetrahedron[4][3] = { { 0, 1, 2 }, { 0, 3, 1 }, { 1, 3, 2 }, { 2, 3, 0 } };
+    static const u32 tetrahedron_neighbors[4][3] = { { 1, 2, 3 }, { 3, 2, 0 }, { 1, 3, 0 }, { 2, 1, 0 } };
+    u32 face_capacity = 2 * count;
+    u32 *vertex_face = scratch + count;
+    u32 *horizon = scratch + 2 * count;     /* 3 per horizon edge: first vertex (then new face), second vertex, outer face */
+    u32 *queue = scratch + 5 * count;
+    hull3_context context;
+    u32 minimum[3], maximum[3], v[4];
+    u32 used = 4, free_head = HULL_NONE, iteration = 0;
+    u32 i, k, axis = 0;
+    real scale = 0.0f, best;
+    vec3 normal;
+
+    if (count < 4)
+    {
+        return 0;
+    }
+    context.points = points;
+    context.faces = faces;
+    context.point_next = scratch;
+    context.pending = scratch + 5 * count + face_capacity;
+    context.pending_count = 0;
+
+    /* Initial tetrahedron: the widest extreme pair, the point farthest from its line, then from their plane. */
+    hull3_extremes(points, count, minimum, maximum);
+    for (k = 0; k < 3; k++)
+    {
+        real low = points[minimum[k]].components[k];
+        real high = points[maximum[k]].components[k];
+        scale += real_max(real_abs(low), real_abs(high));
+        if (high - low > points[maximum[axis]].components[axis] - points[minimum[axis]].components[axis])
+        {
+            axis = k;
+        }
+    }
+    context.tolerance = VECTORS_HULL_TOLERANCE * scale;
+    v[0] = minimum[axis];
+    v[1] = maximum[axis];
+    if (points[v[1]].components[axis] - points[v[0]].components[axis] <= context.tolerance)
+    {
+        return 0;
+    }
+    {
+        vec3 direction = vec3_sub(points[v[1]], points[v[0]]);
+        best = 0.0f;
+        v[2] = v[0];
+        for (i = 0; i < count; i++)
+        {
+            vec3 offset = vec3_cross(vec3_sub(points[i], points[v[0]]), direction);
+            real distance = vec3_dot(offset, offset);
+            if (distance > best)
+            {
+                best = distance;
+                v[2] = i;
+            }
+        }
+        if (real_sqrt(best) <= context.tolerance * vec3_magnitude(direction))
+        {
+            return 0;
+        }
+    }
+    normal = vec3_normalize(vec3_cross(vec3_sub(points[v[1]], points[v[0]]), vec3_sub(points[v[2]], points[v[0]])));
+    best = 0.0f;
+    v[3] = v[0];
+    for (i = 0; i < count; i++)
+    {
+        real distance = real_abs(vec3_dot(vec3_sub(points[i], points[v[0]]), normal));
+        if (distance > best)
+        {
+            best = distance;
+            v[3] = i;
+        }
+    }
+    if (best <= context.tolerance)
+    {
+        return 0;
+    }
+    if (vec3_dot(vec3_sub(points[v[3]], points[v[0]]), normal) > 0.0f)
+    {
+        u32 swap = v[1];
+        v[1] = v[2];
+        v[2] = swap;
+    }
+    for (i = 0; i < 4; i++)
+    {
+        faces[i].flags = 0;
+        hull3_face_init(&context, i, v[tetrahedron[i][0]], v[tetrahedron[i][1]], v[tetrahedron[i][2]]);
+        for (k = 0; k < 3; k++)
+        {
+            faces[i].neighbors[k] = tetrahedron_neighbors[i][k];
+        }
+        queue[i] = i;
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (i != v[0] && i != v[1] && i != v[2] && i != v[3])
+        {
+            hull3_assign(&context, queue, 1, 4, i);
+        }
+    }
+
+    /* Grow the hull by the farthest outside point of a pending face until no face has one. */
+    while (context.pending_count > 0)
+    {
+        u32 seed = context.pending[--context.pending_count];
+        u32 visible_count = 1, horizon_count = 0, gathered = HULL_NONE;
+        u32 eye;
+        vec3 eye_point;
+
+        faces[seed].flags &= ~HULL3_FACE_QUEUED;
+        if (!(faces[seed].flags & HULL3_FACE_ALIVE) || faces[seed].outside == HULL_NONE)
+        {
+            continue;
+        }
+        iteration++;
+        eye = faces[seed].outside;
+        eye_point = points[eye];
+
+        /* Faces the eye sees: a connected patch around the seed. */
+        queue[0] = seed;
+        faces[seed].visited = iteration;
+        faces[seed].visible = iteration;
+        for (i = 0; i < visible_count; i++)
+        {
+            for (k = 0; k < 3; k++)
+            {
+                u32 neighbor = faces[queue[i]].neighbors[k];
+                if (faces[neighbor].visited != iteration)
+                {
+                    faces[neighbor].visited = iteration;
+                    if (hull3_face_distance(&faces[neighbor], eye_point) > 0.0f)
+                    {
+                        faces[neighbor].visible = iteration;
+                        queue[visible_count++] = neighbor;
+                    }
+                }
+            }
+        }
+
+        /* Horizon edges and the orphaned outside points, then release the visible faces. */
+        for (i = 0; i < visible_count; i++)
+        {
+            hull3_face *face = &faces[queue[i]];
+            u32 point = face->outside;
+            for (k = 0; k < 3; k++)
+            {
+                if (faces[face->neighbors[k]].visible != iteration)
+                {
+                    if (horizon_count == count)
+                    {
+                        return 0;
+                    }
+                    horizon[horizon_count * 3 + 0] = face->indices[k];
+                    horizon[horizon_count * 3 + 1] = face->indices[(k + 1) % 3];
+                    horizon[horizon_count * 3 + 2] = face->neighbors[k];
+                    horizon_count++;
+                }
+            }
+            while (point != HULL_NONE)
+            {
+                u32 next = context.point_next[point];
+                if (point != eye)
+                {
+                    context.point_next[point] = gathered;
+                    gathered = point;
+                }
+                point = next;
+            }
+        }
+        for (i = 0; i < visible_count; i++)
+        {
+            hull3_face *face = &faces[queue[i]];
+            face->flags &= ~HULL3_FACE_ALIVE;
+            face->outside = HULL_NONE;
+            face->neighbors[0] = free_head;
+            free_head = queue[i];
+        }
+
+        /* A fan of new faces from each horizon edge to the eye. */
+        for (i = 0; i < horizon_count; i++)
+        {
+            u32 *record = horizon + i * 3;
+            u32 a = record[0], b = record[1], outer = record[2];
+            u32 face;
+            if (free_head != HULL_NONE)
+            {
+                face = free_head;
+                free_head = faces[face].neighbors[0];
+            }
+            else if (used < face_capacity)
+            {
+                face = used++;
+                faces[face].flags = 0;
+            }
+            else
+            {
+                return 0;
+            }
+            hull3_face_init(&context, face, a, b, eye);
+            faces[face].neighbors[0] = outer;
+            for (k = 0; k < 3; k++)
+            {
+                if (faces[outer].indices[k] == b && faces[outer].indices[(k + 1) % 3] == a)
+                {
+                    faces[outer].neighbors[k] = face;
+                }
+            }
+            vertex_face[a] = face;
+            record[0] = face;
+        }
+        for (i = 0; i < horizon_count; i++)
+        {
+            u32 face = horizon[i * 3];
+            u32 next = vertex_face[faces[face].indices[1]];
+            faces[face].neighbors[1] = next;
+            faces[next].neighbors[2] = face;
+        }
+
+        while (gathered != HULL_NONE)
+        {
+            u32 next = context.point_next[gathered];
+            hull3_assign(&context, horizon, 3, horizon_count, gathered);
+            gathered = next;
+        }
+    }
+
+    /* Compact the live faces to the front and remap their neighbors. */
+    {
+        u32 face_count = 0;
+        for (i = 0; i < used; i++)
+        {
+            queue[i] = (faces[i].flags & HULL3_FACE_ALIVE) ? face_count++ : HULL_NONE;
+        }
+        for (i = 0; i < used; i++)
+        {
+            if (queue[i] != HULL_NONE)
+            {
+                faces[queue[i]] = faces[i];
+                for (k = 0; k < 3; k++)
+                {
+                    faces[queue[i]].neighbors[k] = queue[faces[queue[i]].neighbors[k]];
+                }
+            }
+        }
+        return face_count;
+    }
+}
+
+/* Distinct vertex indices of a built hull, written to `vertices`. `marks` holds `count` entries
+   (the point count given to hull3_build). Returns the vertex count. */
+static u32 hull3_vertices(const hull3_face *faces, u32 face_count, u32 count, u32 *marks, u32 *vertices)
+{
+    u32 vertex_count = 0;
+    u32 i, k;
+    for (i = 0; i < count; i++)
+    {
+        marks[i] = 0;
+    }
+    for (i = 0; i < face_count; i++)
+    {
+        for (k = 0; k < 3; k++)
+        {
+            u32 index = faces[i].indices[k];
+            if (!marks[index])
+            {
+                marks[index] = 1;
+                vertices[vertex_count++] = index;
+            }
+        }
+    }
+    return vertex_count;
+}
+
+/* ---- 2D quickhull ---- */
+
+/* Hull vertices strictly right of p -> q among `set`, in order from p to q. Partitions `set` in place. */
+static u32 hull2_expand(const vec2 *points, u32 *set, u32 set_count, u32 p, u32 q, u32 *hull, u32 hull_count)
+{
+    vec2 edge = vec2_sub(points[q], points[p]);
+    real best = 0.0f;
+    u32 farthest = HULL_NONE;
+    u32 front = 0, back = set_count, i = 0;
+    vec2 to_farthest, from_farthest;
+
+    for (i = 0; i < set_count; i++)
+    {
+        real distance = -vec2_perp(edge, vec2_sub(points[set[i]], points[p]));
+        if (distance > best)
+        {
+            best = distance;
+            farthest = set[i];
+        }
+    }
+    if (farthest == HULL_NONE)
+    {
+        return hull_count;
+    }
+
+    /* Right of p -> farthest to the front, right of farthest -> q to the back, the rest is inside. */
+    to_farthest = vec2_sub(points[farthest], points[p]);
+    from_farthest = vec2_sub(points[q], points[farthest]);
+    i = 0;
+    while (i < back)
+    {
+        u32 index = set[i];
+        if (vec2_perp(to_farthest, vec2_sub(points[index], points[p])) < 0.0f)
+        {
+            set[i] = set[front];
+            set[front++] = index;
+            i++;
+        }
+        else if (vec2_perp(from_farthest, vec2_sub(points[index], points[farthest])) < 0.0f)
+        {
+            set[i] = set[--back];
+            set[back] = index;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    hull_count = hull2_expand(points, set, front, p, farthest, hull, hull_count);
+    hull[hull_count++] = farthest;
+    return hull2_expand(points, set + back, set_count - back, farthest, q, hull, hull_count);
+}
+
+/* Convex hull of `count` points as counter-clockwise indices in `hull` (up to `count` entries).
+   `scratch` holds `count` entries. Returns the hull vertex count. */
+static u32 hull2_build(const vec2 *points, u32 count, u32 *scratch, u32 *hull)
+{
+    u32 left = 0, right = 0, front = 0, back = count, hull_count;
+    vec2 edge;
+    u32 i;
+    if (count == 0)
+    {
+        return 0;
+    }
+    for (i = 1; i < count; i++)
+    {
+        vec2 point = points[i];
+        if (point.position.x < points[left].position.x || (point.position.x == points[left].position.x && point.position.y < points[left].position.y))
+        {
+            left = i;
+        }
+        if (point.position.x > points[right].position.x || (point.position.x == points[right].position.x && point.position.y > points[right].position.y))
+        {
+            right = i;
+        }
+    }
+    hull[0] = left;
+    if (left == right)
+    {
+        return 1;
+    }
+
+    /* Below the line left -> right to the front, above it to the back. */
+    edge = vec2_sub(points[right], points[left]);
+    for (i = 0; i < count; i++)
+    {
+        real side = vec2_perp(edge, vec2_sub(points[i], points[left]));
+        if (side < 0.0f)
+        {
+            scratch[front++] = i;
+        }
+        else if (side > 0.0f)
+        {
+            scratch[--back] = i;
+        }
+    }
+    hull_count = hull2_expand(points, scratch, front, left, right, hull, 1);
+    hull[hull_count++] = right;
+    return hull2_expand(points, scratch + back, count - back, right, left, hull, hull_count);
+}
+
+/* ---- oriented bounding boxes ---- */
+
+/* Box along the principal axes (covariance eigenvectors) of the points. The covariance follows point
+   density, so pass hull vertices (hull3_vertices) rather than a whole cloud for a tighter box. */
+static obb obb_from_points(const vec3 *points, u32 count)
+{
+    obb box;
+    vec3 mean = vec3_init_from_1(0.0f);
+    vec3 low, high, eigenvalues;
+    mat3 covariance;
+    real inverse = count > 0 ? 1.0f / (real)count : 0.0f;
+    u32 i, a, b;
+
+    for (i = 0; i < count; i++)
+    {
+        mean = vec3_add(mean, points[i]);
+    }
+    mean = vec3_mul_scalar(mean, inverse);
+    for (i = 0; i < 9; i++)
+    {
+        covariance.data[i] = 0.0f;
+    }
+    for (i = 0; i < count; i++)
+    {
+        vec3 offset = vec3_sub(points[i], mean);
+        for (a = 0; a < 3; a++)
+        {
+            for (b = a; b < 3; b++)
+            {
+                covariance.data[a * 3 + b] += offset.components[a] * offset.components[b];
+            }
+        }
+    }
+    for (a = 0; a < 3; a++)
+    {
+        for (b = a; b < 3; b++)
+        {
+            covariance.data[a * 3 + b] *= inverse;
+            covariance.data[b * 3 + a] = covariance.data[a * 3 + b];
+        }
+    }
+    mat3_eigen_symmetric(covariance, &eigenvalues, box.axes);
+    box.axes[2] = vec3_cross(box.axes[0], box.axes[1]);
+
+    low = vec3_init_from_1(1e30f);
+    high = vec3_init_from_1(-1e30f);
+    for (i = 0; i < count; i++)
+    {
+        vec3 offset = vec3_sub(points[i], mean);
+        vec3 projected = vec3_init_from_3(vec3_dot(offset, box.axes[0]), vec3_dot(offset, box.axes[1]), vec3_dot(offset, box.axes[2]));
+        low = vec3_min(low, projected);
+        high = vec3_max(high, projected);
+    }
+    if (count == 0)
+    {
+        low = vec3_init_from_1(0.0f);
+        high = vec3_init_from_1(0.0f);
+    }
+    box.half_extents = vec3_mul_scalar(vec3_sub(high, low), 0.5f);
+    box.center = mean;
+    for (a = 0; a < 3; a++)
+    {
+        box.center = vec3_fma(box.axes[a], vec3_init_from_1((low.components[a] + high.components[a]) * 0.5f), box.center);
+    }
+    return box;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_HULL_H */
@@ -0,0 +1,564 @@
+#if !defined(VECTORS_IMAGE_H)
+#define VECTORS_IMAGE_H
+
+#include "vectors_color.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_IMAGE_TILE      edge length in pixels of the destination tiles
+                            used by image_resize and of the pixel batches
+                            used by the RGBA8 blend.
+    VECTORS_IMAGE_NO_SIMD   run the blend, resize and convolution loops one
+                            pixel at a time even when SSE or AVX is
+                            available.
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_IMAGE_TILE)
+    #define VECTORS_IMAGE_TILE 64
+#endif
+
+/* Pixels per SIMD register: two vec4 in an AVX register, one in an SSE register. The SIMD loops handle
+   VECTORS_IMAGE_BATCH pixels per iteration and leave the remainder to the scalar code. */
+#if !defined(VECTORS_IMAGE_NO_SIMD)
+    #if defined(__AVX__)
+        #include <immintrin.h>
+        #define VECTORS_IMAGE_LANE_PIXELS 2
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+        #include <xmmintrin.h>
+        #define VECTORS_IMAGE_LANE_PIXELS 1
+    #endif
+    #if defined(VECTORS_IMAGE_LANE_PIXELS)
+        #define VECTORS_IMAGE_BATCH 4
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Images - row-strided pixel buffers owned by the caller. `stride` is in
+   pixels (>= width), so sub-rectangles of a larger image are just a
+   pointer offset. vec4 pixels are linear colors; blending expects them
+   premultiplied (see vec4_premultiply_array). Reads outside the image clamp
+   to the nearest edge pixel.
+   ------------------------------------------------------------------------- */
+
+typedef struct image_vec4
+{
+    vec4 *pixels;
+    u32 width;
+    u32 height;
+    u32 stride;
+} image_vec4;
+
+typedef struct image_rgba8
+{
+    u32 *pixels;    /* packed as color_pack_rgba8 */
+    u32 width;
+    u32 height;
+    u32 stride;
+} image_rgba8;
+
+/* Address of the pixel at a clamped integer coordinate. */
+static const vec4 *image_texel_pointer(const image_vec4 *image, i32 x, i32 y)
+{
+    x = x < 0 ? 0 : (x >= (i32)image->width ? (i32)image->width - 1 : x);
+    y = y < 0 ? 0 : (y >= (i32)image->height ? (i32)image->height - 1 : y);
+    return image->pixels + (u32)y * image->stride + (u32)x;
+}
+
+/* Pixel at a clamped integer coordinate. */
+static vec4 image_texel(const image_vec4 *image, i32 x, i32 y)
+{
+    return *image_texel_pointer(image, x, y);
+}
+
+/* ---- SIMD lanes ---- */
+
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+
+/* VECTORS_IMAGE_LANE_PIXELS consecutive vec4 pixels in one register. The SIMD loops below repeat the
+   scalar operations in the same order; image_lanes_fma fuses only when real_fma does. */
+#if VECTORS_IMAGE_LANE_PIXELS == 2
+typedef __m256 image_lanes;
+
+static image_lanes image_lanes_set(real value)                          { return _mm256_set1_ps(value); }
+static image_lanes image_lanes_load(const vec4 *pixels)                 { return _mm256_loadu_ps(pixels->components); }
+static void image_lanes_store(vec4 *pixels, image_lanes value)          { _mm256_storeu_ps(pixels->components, value); }
+static image_lanes image_lanes_add(image_lanes a, image_lanes b)        { return _mm256_add_ps(a, b); }
+static image_lanes image_lanes_sub(image_lanes a, image_lanes b)        { return _mm256_sub_ps(a, b); }
+static image_lanes image_lanes_mul(image_lanes a, image_lanes b)        { return _mm256_mul_ps(a, b); }
+static image_lanes image_lanes_alpha(image_lanes a)                     { return _mm256_permute_ps(a, 0xff); }
+
+static image_lanes image_lanes_fma(image_lanes a, image_lanes b, image_lanes c)
+{
+#if defined(VECTORS_USE_FMA) && defined(__FMA__) && (defined(__cplusplus) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L))
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+/* Two pixels from anywhere. */
+static image_lanes image_lanes_gather(const vec4 *const *pixels)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(pixels[0]->components)), _mm_loadu_ps(pixels[1]->components), 1);
+}
+
+/* Each pixel's own weight, broadcast across its four components. */
+static image_lanes image_lanes_weights(const real *weights)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(weights[0])), _mm_set1_ps(weights[1]), 1);
+}
+#else
+typedef __m128 image_lanes;
+
+static image_lanes image_lanes_set(real value)                          { return _mm_set1_ps(value); }
+static image_lanes image_lanes_load(const vec4 *pixels)                 { return _mm_loadu_ps(pixels->components); }
+static void image_lanes_store(vec4 *pixels, image_lanes value)          { _mm_storeu_ps(pixels->components, value); }
+static image_lanes image_lanes_add(image_lanes a, image_lanes b)        { return _mm_add_ps(a, b); }
+static image_lanes image_lanes_sub(image_lanes a, image_lanes b)        { return _mm_sub_ps(a, b); }
+static image_lanes image_lanes_mul(image_lanes a, image_lanes b)        { return _mm_mul_ps(a, b); }
+static image_lanes image_lanes_alpha(image_lanes a)                     { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)); }
+static image_lanes image_lanes_fma(image_lanes a, image_lanes b, image_lanes c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static image_lanes image_lanes_gather(const vec4 *const *pixels)        { return _mm_loadu_ps(pixels[0]->components); }
+static image_lanes image_lanes_weights(const real *weights)             { return _mm_set1_ps(weights[0]); }
+#endif
+
+#endif /* VECTORS_IMAGE_LANE_PIXELS */
+
+/* ---- conversion ---- */
+
+/* Unpack an RGBA8 image into a vec4 image of the same size (no transfer function applied). */
+static void image_rgba8_to_vec4(const image_rgba8 *src, image_vec4 *dst)
+{
+    u32 y;
+    for (y = 0; y < src->height; y++)
+    {
+        color_unpack_rgba8_array(src->pixels + y * src->stride, dst->pixels + y * dst->stride, src->width);
+    }
+}
+
+/* Pack a vec4 image into an RGBA8 image of the same size (clamped, rounded). */
+static void image_vec4_to_rgba8(const image_vec4 *src, image_rgba8 *dst)
+{
+    u32 y;
+    for (y = 0; y < src->height; y++)
+    {
+        color_pack_rgba8_array(src->pixels + y * src->stride, dst->pixels + y * dst->stride, src->width);
+    }
+}
+
+/* ---- Porter-Duff compositing ---- */
+
+typedef enum image_blend_op
+{
+    IMAGE_BLEND_CLEAR = 0,
+    IMAGE_BLEND_SRC,
+    IMAGE_BLEND_DST,
+    IMAGE_BLEND_SRC_OVER,
+    IMAGE_BLEND_DST_OVER,
+    IMAGE_BLEND_SRC_IN,
+    IMAGE_BLEND_DST_IN,
+    IMAGE_BLEND_SRC_OUT,
+    IMAGE_BLEND_DST_OUT,
+    IMAGE_BLEND_SRC_ATOP,
+    IMAGE_BLEND_DST_ATOP,
+    IMAGE_BLEND_XOR,
+    IMAGE_BLEND_PLUS
+} image_blend_op;
+
+/* Every operator is src * Fa + dst * Fb with Fa = a + b * dst_alpha and Fb = c + d * src_alpha;
+   image_blend_factors[op] holds (a, b, c, d). */
+static const real image_blend_factors[13][4] =
+{
+    { 0.0f,  0.0f, 0.0f,  0.0f },   /* clear */
+    { 1.0f,  0.0f, 0.0f,  0.0f },   /* src */
+    { 0.0f,  0.0f, 1.0f,  0.0f },   /* dst */
+    { 1.0f,  0.0f, 1.0f, -1.0f },   /* src over */
+    { 1.0f, -1.0f, 1.0f,  0.0f },   /* dst over */
+    { 0.0f,  1.0f, 0.0f,  0.0f },   /* src in */
+    { 0.0f,  0.0f, 0.0f,  1.0f },   /* dst in */
+    { 1.0f, -1.0f, 0.0f,  0.0f },   /* src out */
+    { 0.0f,  0.0f, 1.0f, -1.0f },   /* dst out */
+    { 0.0f,  1.0f, 1.0f, -1.0f },   /* src atop */
+    { 1.0f, -1.0f, 0.0f,  1.0f },   /* dst atop */
+    { 1.0f, -1.0f, 1.0f, -1.0f },   /* xor */
+    { 1.0f,  0.0f, 1.0f,  0.0f }    /* plus (unclamped) */
+};
+
+/* Composite one premultiplied source color over a premultiplied destination color. */
+static vec4 vec4_porter_duff(vec4 src, vec4 dst, image_blend_op op)
+{
+    const real *factors = image_blend_factors[op];
+    real source_factor = factors[0] + factors[1] * dst.color.a;
+    real destination_factor = factors[2] + factors[3] * src.color.a;
+    return vec4_fma(src, vec4_init_from_1(source_factor), vec4_mul_scalar(dst, destination_factor));
+}
+
+/* Composite `count` premultiplied pixels of src into dst in place (operator chosen once, branch-free loop). */
+static void image_blend_row(const vec4 *src, vec4 *dst, u32 count, image_blend_op op)
+{
+    const real *factors = image_blend_factors[op];
+    u32 i = 0;
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+    image_lanes source_base = image_lanes_set(factors[0]), source_alpha = image_lanes_set(factors[1]);
+    image_lanes destination_base = image_lanes_set(factors[2]), destination_alpha = image_lanes_set(factors[3]);
+    u32 k;
+    for (; i + VECTORS_IMAGE_BATCH <= count; i += VECTORS_IMAGE_BATCH)
+    {
+        for (k = 0; k < VECTORS_IMAGE_BATCH; k += VECTORS_IMAGE_LANE_PIXELS)
+        {
+            image_lanes source = image_lanes_load(src + i + k);
+            image_lanes destination = image_lanes_load(dst + i + k);
+            image_lanes source_factor = image_lanes_add(source_base, image_lanes_mul(source_alpha, image_lanes_alpha(destination)));
+            image_lanes destination_factor = image_lanes_add(destination_base, image_lanes_mul(destination_alpha, image_lanes_alpha(source)));
+            image_lanes_store(dst + i + k, image_lanes_fma(source, source_factor, image_lanes_mul(destination, destination_factor)));
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        vec4 source = src[i];
+        vec4 destination = dst[i];
+        real source_factor = factors[0] + factors[1] * destination.color.a;
+        real destination_factor = factors[2] + factors[3] * source.color.a;
+        dst[i] = vec4_fma(source, vec4_init_from_1(source_factor), vec4_mul_scalar(destination, destination_factor));
+    }
+}
+
+/* Composite src into dst over their common size. */
+static void image_blend(const image_vec4 *src, image_vec4 *dst, image_blend_op op)
+{
+    u32 width = src->width < dst->width ? src->width : dst->width;
+    u32 height = src->height < dst->height ? src->height : dst->height;
+    u32 y;
+    for (y = 0; y < height; y++)
+    {
+        image_blend_row(src->pixels + y * src->stride, dst->pixels + y * dst->stride, width, op);
+    }
+}
+
+/* Composite premultiplied RGBA8 images, unpacking VECTORS_IMAGE_TILE pixels at a time into stack buffers. */
+static void image_blend_rgba8(const image_rgba8 *src, image_rgba8 *dst, image_blend_op op)
+{
+    vec4 source[VECTORS_IMAGE_TILE];
+    vec4 destination[VECTORS_IMAGE_TILE];
+    u32 width = src->width < dst->width ? src->width : dst->width;
+    u32 height = src->height < dst->height ? src->height : dst->height;
+    u32 x, y;
+    for (y = 0; y < height; y++)
+    {
+        const u32 *source_row = src->pixels + y * src->stride;
+        u32 *destination_row = dst->pixels + y * dst->stride;
+        for (x = 0; x < width; x += VECTORS_IMAGE_TILE)
+        {
+            u32 count = width - x < VECTORS_IMAGE_TILE ? width - x : VECTORS_IMAGE_TILE;
+            color_unpack_rgba8_array(source_row + x, source, count);
+            color_unpack_rgba8_array(destination_row + x, destination, count);
+            image_blend_row(source, destination, count, op);
+            color_pack_rgba8_array(destination, destination_row + x, count);
+        }
+    }
+}
+
+/* ---- resampling ---- */
+
+typedef enum image_filter
+{
+    IMAGE_FILTER_BILINEAR = 0,
+    IMAGE_FILTER_BICUBIC = 1
+} image_filter;
+
+/* Bilinear sample at continuous pixel coordinates (pixel centres at +0.5). */
+static vec4 image_sample_bilinear(const image_vec4 *image, real x, real y)
+{
+    real fx = x - 0.5f, fy = y - 0.5f;
+    real x0 = real_floor(fx), y0 = real_floor(fy);
+    real tx = fx - x0, ty = fy - y0;
+    i32 ix = (i32)x0, iy = (i32)y0;
+    vec4 top = vec4_lerp(image_texel(image, ix, iy), image_texel(image, ix + 1, iy), tx);
+    vec4 bottom = vec4_lerp(image_texel(image, ix, iy + 1), image_texel(image, ix + 1, iy + 1), tx);
+    return vec4_lerp(top, bottom, ty);
+}
+
+/* Catmull-Rom weights of the four taps around a fractional position t in [0, 1). */
+static void image_cubic_weights(real t, real *weights)
+{
+    real t2 = t * t, t3 = t2 * t;
+    weights[0] = -0.5f * t3 + t2 - 0.5f * t;
+    weights[1] = 1.5f * t3 - 2.5f * t2 + 1.0f;
+    weights[2] = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
+    weights[3] = 0.5f * t3 - 0.5f * t2;
+}
+
+/* Bicubic (Catmull-Rom) sample at continuous pixel coordinates; may overshoot slightly at hard edges. */
+static vec4 image_sample_bicubic(const image_vec4 *image, real x, real y)
+{
+    real fx = x - 0.5f, fy = y - 0.5f;
+    real x0 = real_floor(fx), y0 = real_floor(fy);
+    real wx[4], wy[4];
+    i32 ix = (i32)x0 - 1, iy = (i32)y0 - 1;
+    vec4 sum = vec4_init_from_1(0.0f);
+    i32 row, column;
+    image_cubic_weights(fx - x0, wx);
+    image_cubic_weights(fy - y0, wy);
+    for (row = 0; row < 4; row++)
+    {
+        vec4 line = vec4_init_from_1(0.0f);
+        for (column = 0; column < 4; column++)
+        {
+            line = vec4_fma(image_texel(image, ix + column, iy + row), vec4_init_from_1(wx[column]), line);
+        }
+        sum = vec4_fma(line, vec4_init_from_1(wy[row]), sum);
+    }
+    return sum;
+}
+
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+/* Horizontal taps of one resize tile, shared by all of its rows: clamped source columns and weights
+   ([tap][pixel], so a lane's weights are contiguous). Bilinear uses taps 0-1 and only weight 0 (tx). */
+typedef struct image_resize_taps
+{
+    u32 columns[4][VECTORS_IMAGE_TILE];
+    real weights[4][VECTORS_IMAGE_TILE];
+} image_resize_taps;
+
+static void image_resize_taps_init(const image_vec4 *src, u32 first, u32 count, real scale_x, image_filter filter, image_resize_taps *taps)
+{
+    u32 pixel, tap;
+    for (pixel = 0; pixel < count; pixel++)
+    {
+        real fx = ((real)(first + pixel) + 0.5f) * scale_x - 0.5f;
+        real x0 = real_floor(fx);
+        real cubic[4];
+        i32 ix = filter == IMAGE_FILTER_BICUBIC ? (i32)x0 - 1 : (i32)x0;
+        image_cubic_weights(fx - x0, cubic);
+        for (tap = 0; tap < 4; tap++)
+        {
+            i32 column = ix + (i32)tap;
+            taps->columns[tap][pixel] = (u32)(column < 0 ? 0 : (column >= (i32)src->width ? (i32)src->width - 1 : column));
+            taps->weights[tap][pixel] = filter == IMAGE_FILTER_BICUBIC ? cubic[tap] : fx - x0;
+        }
+    }
+}
+
+/* The VECTORS_IMAGE_LANE_PIXELS texels of lanes starting at `pixel`, taken from one source row. */
+static image_lanes image_resize_gather(const vec4 *row, const image_resize_taps *taps, u32 tap, u32 pixel)
+{
+    const vec4 *texels[VECTORS_IMAGE_LANE_PIXELS];
+    u32 n;
+    for (n = 0; n < VECTORS_IMAGE_LANE_PIXELS; n++)
+    {
+        texels[n] = row + taps->columns[tap][pixel + n];
+    }
+    return image_lanes_gather(texels);
+}
+
+/* Resample the first multiple of VECTORS_IMAGE_BATCH of `count` tile pixels of one output row, as
+   image_sample_bilinear / image_sample_bicubic would one by one. Returns the number written. */
+static u32 image_resize_row(const image_vec4 *src, const image_resize_taps *taps, real source_y, image_filter filter, vec4 *out, u32 count)
+{
+    const vec4 *rows[4];
+    real wy[4];
+    real fy = source_y - 0.5f;
+    real y0 = real_floor(fy);
+    i32 iy = filter == IMAGE_FILTER_BICUBIC ? (i32)y0 - 1 : (i32)y0;
+    u32 x = 0, row, tap;
+
+    image_cubic_weights(fy - y0, wy);
+    for (row = 0; row < 4; row++)
+    {
+        rows[row] = image_texel_pointer(src, 0, iy + (i32)row);
+    }
+    if (filter == IMAGE_FILTER_BICUBIC)
+    {
+        for (; x + VECTORS_IMAGE_BATCH <= count; x += VECTORS_IMAGE_BATCH)
+        {
+            u32 k;
+            for (k = x; k < x + VECTORS_IMAGE_BATCH; k += VECTORS_IMAGE_LANE_PIXELS)
+            {
+                image_lanes sum = image_lanes_set(0.0f);
+                for (row = 0; row < 4; row++)
+                {
+                    image_lanes line = image_lanes_set(0.0f);
+                    for (tap = 0; tap < 4; tap++)
+                    {
+                        line = image_lanes_fma(image_resize_gather(rows[row], taps, tap, k), image_lanes_weights(taps->weights[tap] + k), line);
+                    }
+                    sum = image_lanes_fma(line, image_lanes_set(wy[row]), sum);
+                }
+                image_lanes_store(out + k, sum);
+            }
+        }
+    }
+    else
+    {
+        image_lanes ty = image_lanes_set(fy - y0);
+        for (; x + VECTORS_IMAGE_BATCH <= count; x += VECTORS_IMAGE_BATCH)
+        {
+            u32 k;
+            for (k = x; k < x + VECTORS_IMAGE_BATCH; k += VECTORS_IMAGE_LANE_PIXELS)
+            {
+                image_lanes tx = image_lanes_weights(taps->weights[0] + k);
+                image_lanes top_left = image_resize_gather(rows[0], taps, 0, k), bottom_left = image_resize_gather(rows[1], taps, 0, k);
+                image_lanes top = image_lanes_fma(image_lanes_sub(image_resize_gather(rows[0], taps, 1, k), top_left), tx, top_left);
+                image_lanes bottom = image_lanes_fma(image_lanes_sub(image_resize_gather(rows[1], taps, 1, k), bottom_left), tx, bottom_left);
+                image_lanes_store(out + k, image_lanes_fma(image_lanes_sub(bottom, top), ty, top));
+            }
+        }
+    }
+    return x;
+}
+#endif
+
+/* Resample src to fill dst (any scale, pixel-centre aligned). dst is walked in VECTORS_IMAGE_TILE square
+   tiles so the source footprint of a tile stays in cache. Intended for magnification and mild
+   minification; for strong downscaling blur first with image_convolve_separable. */
+static void image_resize(const image_vec4 *src, image_vec4 *dst, image_filter filter)
+{
+    real scale_x = (real)src->width / (real)dst->width;
+    real scale_y = (real)src->height / (real)dst->height;
+    u32 tile_x, tile_y, x, y;
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+    image_resize_taps taps;
+#endif
+    for (tile_y = 0; tile_y < dst->height; tile_y += VECTORS_IMAGE_TILE)
+    for (tile_x = 0; tile_x < dst->width; tile_x += VECTORS_IMAGE_TILE)
+    {
+        u32 end_y = tile_y + VECTORS_IMAGE_TILE < dst->height ? tile_y + VECTORS_IMAGE_TILE : dst->height;
+        u32 end_x = tile_x + VECTORS_IMAGE_TILE < dst->width ? tile_x + VECTORS_IMAGE_TILE : dst->width;
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+        image_resize_taps_init(src, tile_x, end_x - tile_x, scale_x, filter, &taps);
+#endif
+        for (y = tile_y; y < end_y; y++)
+        {
+            vec4 *row = dst->pixels + y * dst->stride;
+            real source_y = ((real)y + 0.5f) * scale_y;
+            x = tile_x;
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+            x += image_resize_row(src, &taps, source_y, filter, row + tile_x, end_x - tile_x);
+#endif
+            for (; x < end_x; x++)
+            {
+                real source_x = ((real)x + 0.5f) * scale_x;
+                row[x] = filter == IMAGE_FILTER_BICUBIC ? image_sample_bicubic(src, source_x, source_y)
+                                                        : image_sample_bilinear(src, source_x, source_y);
+            }
+        }
+    }
+}
+
+/* ---- convolution ---- */
+
+/* Fill `2 * radius + 1` normalized Gaussian weights with the given sigma. */
+static void image_gaussian_kernel(real sigma, u32 radius, real *kernel)
+{
+    real scale = -0.5f / (sigma * sigma);
+    real sum = 0.0f;
+    u32 i;
+    for (i = 0; i <= 2 * radius; i++)
+    {
+        real offset = (real)i - (real)radius;
+        kernel[i] = real_exp(offset * offset * scale);
+        sum += kernel[i];
+    }
+    for (i = 0; i <= 2 * radius; i++)
+    {
+        kernel[i] /= sum;
+    }
+}
+
+/* Separable convolution of src into dst (same size) with a `2 * radius + 1` tap kernel applied
+   horizontally then vertically; `scratch` is an image of the same size holding the horizontal pass.
+   Both passes stream whole rows: the vertical pass accumulates weighted source rows into the output row
+   rather than walking columns. dst must not alias src or scratch. */
+static void image_convolve_separable(const image_vec4 *src, image_vec4 *scratch, image_vec4 *dst, const real *kernel, u32 radius)
+{
+    u32 width = src->width, height = src->height;
+    u32 x, y, tap;
+
+    for (y = 0; y < height; y++)
+    {
+        const vec4 *row = src->pixels + y * src->stride;
+        vec4 *out = scratch->pixels + y * scratch->stride;
+        for (x = 0; x < width; x++)
+        {
+            vec4 sum = vec4_init_from_1(0.0f);
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+            /* Away from the edges the taps of a batch are contiguous: no clamping, one load per register. */
+            if (x >= radius && x + VECTORS_IMAGE_BATCH + radius <= width)
+            {
+                image_lanes sums[VECTORS_IMAGE_BATCH / VECTORS_IMAGE_LANE_PIXELS];
+                u32 k;
+                for (k = 0; k < VECTORS_IMAGE_BATCH / VECTORS_IMAGE_LANE_PIXELS; k++)
+                {
+                    sums[k] = image_lanes_set(0.0f);
+                }
+                for (tap = 0; tap <= 2 * radius; tap++)
+                {
+                    image_lanes weight = image_lanes_set(kernel[tap]);
+                    for (k = 0; k < VECTORS_IMAGE_BATCH / VECTORS_IMAGE_LANE_PIXELS; k++)
+                    {
+                        sums[k] = image_lanes_fma(image_lanes_load(row + x - radius + tap + k * VECTORS_IMAGE_LANE_PIXELS), weight, sums[k]);
+                    }
+                }
+                for (k = 0; k < VECTORS_IMAGE_BATCH / VECTORS_IMAGE_LANE_PIXELS; k++)
+                {
+                    image_lanes_store(out + x + k * VECTORS_IMAGE_LANE_PIXELS, sums[k]);
+                }
+                x += VECTORS_IMAGE_BATCH - 1;
+                continue;
+            }
+#endif
+            for (tap = 0; tap <= 2 * radius; tap++)
+            {
+                i32 source_x = (i32)x + (i32)tap - (i32)radius;
+                source_x = source_x < 0 ? 0 : (source_x >= (i32)width ? (i32)width - 1 : source_x);
+                sum = vec4_fma(row[source_x], vec4_init_from_1(kernel[tap]), sum);
+            }
+            out[x] = sum;
+        }
+    }
+
+    for (y = 0; y < height; y++)
+    {
+        vec4 *out = dst->pixels + y * dst->stride;
+        for (x = 0; x < width; x++)
+        {
+            out[x] = vec4_init_from_1(0.0f);
+        }
+        for (tap = 0; tap <= 2 * radius; tap++)
+        {
+            i32 source_y = (i32)y + (i32)tap - (i32)radius;
+            vec4 weight = vec4_init_from_1(kernel[tap]);
+            const vec4 *row;
+            source_y = source_y < 0 ? 0 : (source_y >= (i32)height ? (i32)height - 1 : source_y);
+            row = scratch->pixels + (u32)source_y * scratch->stride;
+            x = 0;
+#if defined(VECTORS_IMAGE_LANE_PIXELS)
+            {
+                image_lanes weights = image_lanes_set(kernel[tap]);
+                for (; x + VECTORS_IMAGE_BATCH <= width; x += VECTORS_IMAGE_BATCH)
+                {
+                    u32 k;
+                    for (k = 0; k < VECTORS_IMAGE_BATCH; k += VECTORS_IMAGE_LANE_PIXELS)
+                    {
+                        image_lanes_store(out + x + k, image_lanes_fma(image_lanes_load(row + x + k), weights, image_lanes_load(out + x + k)));
+                    }
+                }
+            }
+#endif
+            for (; x < width; x++)
+            {
+                out[x] = vec4_fma(row[x], weight, out[x]);
+            }
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_IMAGE_H */
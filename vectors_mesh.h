@@ -0,0 +1,269 @@
+#if !defined(VECTORS_MESH_H)
+#define VECTORS_MESH_H
+
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Indexed triangle meshes - three vertex indices per triangle. Corner c is
+   vertex c % 3 of triangle c / 3. Per-vertex results are gathered rather
+   than scattered: mesh_build_adjacency lists the corners that touch each
+   vertex (a counting sort, CSR layout), and every vertex then sums its own
+   corners. No two vertices write the same memory, so any vertex range can
+   run on its own thread without atomics, and the sum order per vertex is
+   fixed, so results do not depend on the thread count.
+   ------------------------------------------------------------------------- */
+
+typedef struct mesh
+{
+    u32 vertex_count;
+    u32 triangle_count;
+    const vec3 *positions;
+    const vec2 *texcoords;          /* only needed for tangents */
+    const u32 *indices;             /* 3 * triangle_count */
+    const u32 *corner_offsets;      /* vertex_count + 1, from mesh_build_adjacency */
+    const u32 *corners;             /* 3 * triangle_count, from mesh_build_adjacency */
+} mesh;
+
+/* How a triangle's contribution to its vertices is weighted when summing normals. */
+typedef enum mesh_weighting
+{
+    MESH_WEIGHT_UNIFORM = 0,    /* every triangle counts the same */
+    MESH_WEIGHT_AREA = 1,       /* by triangle area */
+    MESH_WEIGHT_ANGLE = 2       /* by the triangle's angle at the vertex (tessellation independent) */
+} mesh_weighting;
+
+/* Corners touching each vertex: corners[offsets[v] .. offsets[v + 1]) in ascending order. */
+static void mesh_build_adjacency(const u32 *indices, u32 triangle_count, u32 vertex_count, u32 *offsets, u32 *corners)
+{
+    u32 corner_count = triangle_count * 3;
+    u32 running = 0;
+    u32 c, v;
+    for (v = 0; v <= vertex_count; v++)
+    {
+        offsets[v] = 0;
+    }
+    for (c = 0; c < corner_count; c++)
+    {
+        offsets[indices[c]]++;
+    }
+    for (v = 0; v < vertex_count; v++)
+    {
+        u32 count = offsets[v];
+        offsets[v] = running;
+        running += count;
+    }
+    offsets[vertex_count] = running;
+    for (c = 0; c < corner_count; c++)
+    {
+        corners[offsets[indices[c]]++] = c;
+    }
+    /* The scatter advanced every offset to the next vertex's start; shift them back. */
+    for (v = vertex_count; v > 0; v--)
+    {
+        offsets[v] = offsets[v - 1];
+    }
+    offsets[0] = 0;
+}
+
+/* Unnormalized normal of a triangle (length is twice its area). */
+static vec3 mesh_triangle_cross(const mesh *geometry, u32 triangle)
+{
+    const u32 *index = geometry->indices + triangle * 3;
+    vec3 p0 = geometry->positions[index[0]];
+    return vec3_cross(vec3_sub(geometry->positions[index[1]], p0), vec3_sub(geometry->positions[index[2]], p0));
+}
+
+/* Interior angle of a triangle at one corner (0 for degenerate corners). */
+static real mesh_corner_angle(const mesh *geometry, u32 corner)
+{
+    const u32 *index = geometry->indices + (corner / 3) * 3;
+    u32 k = corner % 3;
+    vec3 p = geometry->positions[index[k]];
+    vec3 edge0 = vec3_sub(geometry->positions[index[(k + 1) % 3]], p);
+    vec3 edge1 = vec3_sub(geometry->positions[index[(k + 2) % 3]], p);
+    real length_product = real_sqrt(vec3_dot(edge0, edge0) * vec3_dot(edge1, edge1));
+    real cosine;
+    if (length_product <= 0.0f)
+    {
+        return 0.0f;
+    }
+    cosine = vec3_dot(edge0, edge1) / length_product;
+    return real_acos(cosine < -1.0f ? -1.0f : (cosine > 1.0f ? 1.0f : cosine));
+}
+
+/* Normalize, leaving zero vectors (isolated or fully degenerate vertices) at zero. */
+static vec3 mesh_normalize_or_zero(vec3 vector)
+{
+    real length_squared = vec3_dot(vector, vector);
+    return length_squared > 0.0f ? vec3_mul_scalar(vector, 1.0f / real_sqrt(length_squared)) : vector;
+}
+
+/* Unit normal of every triangle (zero for degenerate triangles). */
+static void mesh_face_normals(const mesh *geometry, vec3 *normals)
+{
+    u32 t;
+    for (t = 0; t < geometry->triangle_count; t++)
+    {
+        normals[t] = mesh_normalize_or_zero(mesh_triangle_cross(geometry, t));
+    }
+}
+
+/* Contribution of one corner's triangle to the corner's vertex normal. */
+static vec3 mesh_corner_normal(const mesh *geometry, u32 corner, mesh_weighting weighting)
+{
+    vec3 cross = mesh_triangle_cross(geometry, corner / 3);
+    if (weighting == MESH_WEIGHT_AREA)
+    {
+        return cross;
+    }
+    cross = mesh_normalize_or_zero(cross);
+    return weighting == MESH_WEIGHT_ANGLE ? vec3_mul_scalar(cross, mesh_corner_angle(geometry, corner)) : cross;
+}
+
+/* Smooth unit normals of vertices [begin, end). */
+static void mesh_vertex_normals_range(const mesh *geometry, mesh_weighting weighting, vec3 *normals, u32 begin, u32 end)
+{
+    u32 v, i;
+    for (v = begin; v < end; v++)
+    {
+        vec3 sum = vec3_init_from_1(0.0f);
+        for (i = geometry->corner_offsets[v]; i < geometry->corner_offsets[v + 1]; i++)
+        {
+            sum = vec3_add(sum, mesh_corner_normal(geometry, geometry->corners[i], weighting));
+        }
+        normals[v] = mesh_normalize_or_zero(sum);
+    }
+}
+
+/* Smooth unit normals of every vertex. */
+static void mesh_vertex_normals(const mesh *geometry, mesh_weighting weighting, vec3 *normals)
+{
+    mesh_vertex_normals_range(geometry, weighting, normals, 0, geometry->vertex_count);
+}
+
+/* Texture-space tangent and bitangent directions of a triangle (unnormalized; zero for degenerate UVs). */
+static void mesh_triangle_tangents(const mesh *geometry, u32 triangle, vec3 *tangent, vec3 *bitangent)
+{
+    const u32 *index = geometry->indices + triangle * 3;
+    vec3 p0 = geometry->positions[index[0]];
+    vec2 uv0 = geometry->texcoords[index[0]];
+    vec3 edge1 = vec3_sub(geometry->positions[index[1]], p0);
+    vec3 edge2 = vec3_sub(geometry->positions[index[2]], p0);
+    vec2 duv1 = vec2_sub(geometry->texcoords[index[1]], uv0);
+    vec2 duv2 = vec2_sub(geometry->texcoords[index[2]], uv0);
+    real determinant = duv1.components[0] * duv2.components[1] - duv2.components[0] * duv1.components[1];
+    real sign = determinant < 0.0f ? -1.0f : 1.0f;
+    if (determinant == 0.0f)
+    {
+        *tangent = vec3_init_from_1(0.0f);
+        *bitangent = vec3_init_from_1(0.0f);
+        return;
+    }
+    /* Scale by sign(det) only: the direction is all that is kept, and it avoids huge values for tiny UV areas. */
+    *tangent = vec3_mul_scalar(vec3_sub(vec3_mul_scalar(edge1, duv2.components[1]), vec3_mul_scalar(edge2, duv1.components[1])), sign);
+    *bitangent = vec3_mul_scalar(vec3_sub(vec3_mul_scalar(edge2, duv1.components[0]), vec3_mul_scalar(edge1, duv2.components[0])), sign);
+}
+
+/* MikkTSpace-style tangent frames of vertices [begin, end) as (tangent, handedness): each corner adds its
+   triangle's normalized tangent and bitangent weighted by the corner angle, the sum is Gram-Schmidt
+   orthogonalized against the vertex normal, and w = +-1 gives the bitangent as w * cross(normal, tangent).
+   Needs texcoords and vertex normals (e.g. from mesh_vertex_normals). Vertices are not split at UV seams;
+   weld or split the mesh beforehand if seams must get separate frames. */
+static void mesh_vertex_tangents_range(const mesh *geometry, const vec3 *normals, vec4 *tangents, u32 begin, u32 end)
+{
+    u32 v, i;
+    for (v = begin; v < end; v++)
+    {
+        vec3 normal = normals[v];
+        vec3 tangent_sum = vec3_init_from_1(0.0f);
+        vec3 bitangent_sum = vec3_init_from_1(0.0f);
+        vec3 tangent;
+        for (i = geometry->corner_offsets[v]; i < geometry->corner_offsets[v + 1]; i++)
+        {
+            u32 corner = geometry->corners[i];
+            real angle = mesh_corner_angle(geometry, corner);
+            vec3 tangent_direction, bitangent_direction;
+            mesh_triangle_tangents(geometry, corner / 3, &tangent_direction, &bitangent_direction);
+            tangent_sum = vec3_fma(mesh_normalize_or_zero(tangent_direction), vec3_init_from_1(angle), tangent_sum);
+            bitangent_sum = vec3_fma(mesh_normalize_or_zero(bitangent_direction), vec3_init_from_1(angle), bitangent_sum);
+        }
+        tangent = mesh_normalize_or_zero(vec3_fma(normal, vec3_init_from_1(-vec3_dot(normal, tangent_sum)), tangent_sum));
+        if (vec3_dot(tangent, tangent) == 0.0f)
+        {
+            /* No usable UV gradient: any direction perpendicular to the normal. */
+            vec3 axis = real_abs(normal.components[0]) < 0.9f ? vec3_init_from_3(1.0f, 0.0f, 0.0f) : vec3_init_from_3(0.0f, 1.0f, 0.0f);
+            tangent = mesh_normalize_or_zero(vec3_cross(axis, normal));
+        }
+        tangents[v].vec3 = tangent;
+        tangents[v].components[3] = vec3_dot(vec3_cross(normal, tangent), bitangent_sum) < 0.0f ? -1.0f : 1.0f;
+    }
+}
+
+/* Tangent frames of every vertex. */
+static void mesh_vertex_tangents(const mesh *geometry, const vec3 *normals, vec4 *tangents)
+{
+    mesh_vertex_tangents_range(geometry, normals, tangents, 0, geometry->vertex_count);
+}
+
+#if defined(VECTORS_PARALLEL_H)
+/* -------------------------------------------------------------------------
+   Parallel forms - vertex ranges on a parallel_pool (vectors_parallel.h)
+   ------------------------------------------------------------------------- */
+
+typedef struct mesh_parallel_args
+{
+    const mesh *geometry;
+    mesh_weighting weighting;
+    const vec3 *normals;
+    vec3 *normals_out;
+    vec4 *tangents_out;
+} mesh_parallel_args;
+
+static void mesh_vertex_normals_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    mesh_parallel_args *args = (mesh_parallel_args *)user;
+    (void)worker;
+    mesh_vertex_normals_range(args->geometry, args->weighting, args->normals_out, begin, end);
+}
+
+static void mesh_vertex_tangents_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    mesh_parallel_args *args = (mesh_parallel_args *)user;
+    (void)worker;
+    mesh_vertex_tangents_range(args->geometry, args->normals, args->tangents_out, begin, end);
+}
+
+/* mesh_vertex_normals split over the pool (identical results for any worker count). */
+static void mesh_vertex_normals_parallel(parallel_pool *pool, const mesh *geometry, mesh_weighting weighting, vec3 *normals)
+{
+    mesh_parallel_args args;
+    args.geometry = geometry;
+    args.weighting = weighting;
+    args.normals = NULL;
+    args.normals_out = normals;
+    args.tangents_out = NULL;
+    parallel_for(pool, geometry->vertex_count, parallel_grain(sizeof(vec3)), mesh_vertex_normals_task, &args);
+}
+
+/* mesh_vertex_tangents split over the pool (identical results for any worker count). */
+static void mesh_vertex_tangents_parallel(parallel_pool *pool, const mesh *geometry, const vec3 *normals, vec4 *tangents)
+{
+    mesh_parallel_args args;
+    args.geometry = geometry;
+    args.weighting = MESH_WEIGHT_ANGLE;
+    args.normals = normals;
+    args.normals_out = NULL;
+    args.tangents_out = tangents;
+    parallel_for(pool, geometry->vertex_count, parallel_grain(sizeof(vec4)), mesh_vertex_tangents_task, &args);
+}
+#endif /* VECTORS_PARALLEL_H */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_MESH_H */
@@ -0,0 +1,392 @@
+#if !defined(VECTORS_MORTON_H)
+#define VECTORS_MORTON_H
+
+#include <stdlib.h>
+#include <string.h>
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_MORTON_NO_BMI2  use the shift/mask path even when BMI2 is
+                            available (pdep/pext are microcoded and slow
+                            on AMD before Zen 3).
+    Include "vectors_parallel.h" first to also get morton_sort*_parallel.
+   ------------------------------------------------------------------------- */
+#if defined(__BMI2__) && !defined(VECTORS_MORTON_NO_BMI2)
+    #include <immintrin.h>
+    #define VECTORS_MORTON_BMI2 1
+    #if defined(__x86_64__) || defined(_M_X64)
+        #define VECTORS_MORTON_BMI2_64 1
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 64-bit constant from two 32-bit halves (C89 has no long long literals). */
+#define MORTON_U64(high, low) (((u64)(high) << 32) | (u64)(low))
+
+/* -------------------------------------------------------------------------
+   Morton (Z-order) codes - x in bit 0, y in bit 1, z in bit 2 of each
+   triple. 30-bit codes hold 10 bits per axis in a u32, 63-bit codes hold
+   21 bits per axis in a u64.
+   ------------------------------------------------------------------------- */
+
+/* Spread the low 10 bits of v so there are two zero bits between each. */
+static u32 morton_spread30(u32 v)
+{
+#if defined(VECTORS_MORTON_BMI2)
+    return _pdep_u32(v, 0x09249249u);
+#else
+    v &= 0x000003FFu;
+    v = (v | (v << 16)) & 0x030000FFu;
+    v = (v | (v << 8))  & 0x0300F00Fu;
+    v = (v | (v << 4))  & 0x030C30C3u;
+    v = (v | (v << 2))  & 0x09249249u;
+    return v;
+#endif
+}
+
+/* Inverse of morton_spread30. */
+static u32 morton_compact30(u32 v)
+{
+#if defined(VECTORS_MORTON_BMI2)
+    return _pext_u32(v, 0x09249249u);
+#else
+    v &= 0x09249249u;
+    v = (v | (v >> 2))  & 0x030C30C3u;
+    v = (v | (v >> 4))  & 0x0300F00Fu;
+    v = (v | (v >> 8))  & 0x030000FFu;
+    v = (v | (v >> 16)) & 0x000003FFu;
+    return v;
+#endif
+}
+
+/* Spread the low 21 bits of v so there are two zero bits between each. */
+static u64 morton_spread63(u64 v)
+{
+#if defined(VECTORS_MORTON_BMI2_64)
+    return _pdep_u64(v, MORTON_U64(0x12492492u, 0x49249249u));
+#else
+    v &= MORTON_U64(0x00000000u, 0x001FFFFFu);
+    v = (v | (v << 32)) & MORTON_U64(0x001F0000u, 0x0000FFFFu);
+    v = (v | (v << 16)) & MORTON_U64(0x001F0000u, 0xFF0000FFu);
+    v = (v | (v << 8))  & MORTON_U64(0x100F00F0u, 0x0F00F00Fu);
+    v = (v | (v << 4))  & MORTON_U64(0x10C30C30u, 0xC30C30C3u);
+    v = (v | (v << 2))  & MORTON_U64(0x12492492u, 0x49249249u);
+    return v;
+#endif
+}
+
+/* Inverse of morton_spread63. */
+static u64 morton_compact63(u64 v)
+{
+#if defined(VECTORS_MORTON_BMI2_64)
+    return _pext_u64(v, MORTON_U64(0x12492492u, 0x49249249u));
+#else
+    v &= MORTON_U64(0x12492492u, 0x49249249u);
+    v = (v | (v >> 2))  & MORTON_U64(0x10C30C30u, 0xC30C30C3u);
+    v = (v | (v >> 4))  & MORTON_U64(0x100F00F0u, 0x0F00F00Fu);
+    v = (v | (v >> 8))  & MORTON_U64(0x001F0000u, 0xFF0000FFu);
+    v = (v | (v >> 16)) & MORTON_U64(0x001F0000u, 0x0000FFFFu);
+    v = (v | (v >> 32)) & MORTON_U64(0x00000000u, 0x001FFFFFu);
+    return v;
+#endif
+}
+
+/* Interleave three 10-bit cell coordinates into a 30-bit code. */
+static u32 morton_encode30(uvec3 cell)
+{
+    return morton_spread30(cell.components[0]) | (morton_spread30(cell.components[1]) << 1) | (morton_spread30(cell.components[2]) << 2);
+}
+
+/* Split a 30-bit code back into its cell coordinates. */
+static uvec3 morton_decode30(u32 code)
+{
+    return uvec3_init_from_3(morton_compact30(code), morton_compact30(code >> 1), morton_compact30(code >> 2));
+}
+
+/* Interleave three 21-bit cell coordinates into a 63-bit code. */
+static u64 morton_encode63(uvec3 cell)
+{
+    return morton_spread63(cell.components[0]) | (morton_spread63(cell.components[1]) << 1) | (morton_spread63(cell.components[2]) << 2);
+}
+
+/* Split a 63-bit code back into its cell coordinates. */
+static uvec3 morton_decode63(u64 code)
+{
+    return uvec3_init_from_3((u32)morton_compact63(code), (u32)morton_compact63(code >> 1), (u32)morton_compact63(code >> 2));
+}
+
+/* Per-axis scale mapping [minimum, maximum] onto [0, cells - 1] (degenerate axes map to 0). */
+static vec3 morton_quantize_scale(vec3 minimum, vec3 maximum, real cells)
+{
+    vec3 extent = vec3_sub(maximum, minimum);
+    vec3 scale;
+    scale.components[0] = extent.components[0] > 0.0f ? (cells - 1.0f) / extent.components[0] : 0.0f;
+    scale.components[1] = extent.components[1] > 0.0f ? (cells - 1.0f) / extent.components[1] : 0.0f;
+    scale.components[2] = extent.components[2] > 0.0f ? (cells - 1.0f) / extent.components[2] : 0.0f;
+    return scale;
+}
+
+/* 30-bit codes for `count` points quantized inside the box [minimum, maximum] (outside points are clamped). */
+static void morton30_from_vec3_array(const vec3 *points, u32 count, vec3 minimum, vec3 maximum, u32 *codes)
+{
+    vec3 scale = morton_quantize_scale(minimum, maximum, 1024.0f);
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec3 grid = vec3_clamp_scalar(vec3_mul(vec3_sub(points[i], minimum), scale), 0.0f, 1023.0f);
+        codes[i] = morton_encode30(uvec3_from_vec3_trunc(grid));
+    }
+}
+
+/* 63-bit codes for `count` points quantized inside the box [minimum, maximum] (outside points are clamped). */
+static void morton63_from_vec3_array(const vec3 *points, u32 count, vec3 minimum, vec3 maximum, u64 *codes)
+{
+    vec3 scale = morton_quantize_scale(minimum, maximum, 2097152.0f);
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        vec3 grid = vec3_clamp_scalar(vec3_mul(vec3_sub(points[i], minimum), scale), 0.0f, 2097151.0f);
+        codes[i] = morton_encode63(uvec3_from_vec3_trunc(grid));
+    }
+}
+
+/* -------------------------------------------------------------------------
+   Radix sort - stable LSD sort on 8-bit digits that carries an index
+   permutation along with the codes. Passes whose digit is the same for
+   every key are skipped. `scratch_codes`/`scratch_indices` must hold
+   `count` entries; the sorted result ends up back in `codes`/`indices`.
+   ------------------------------------------------------------------------- */
+
+/* Digit `shift` of key i, where keys are u32 (`wide` false) or u64 (`wide` true). */
+static u32 morton_digit(const void *keys, bool wide, u32 i, u32 shift)
+{
+    u64 key = wide ? ((const u64 *)keys)[i] : ((const u32 *)keys)[i];
+    return (u32)(key >> shift) & 0xFFu;
+}
+
+/* Scatter [begin, end) of one pass using per-digit write cursors. */
+static void morton_scatter(const void *keys, const u32 *indices, void *out_keys, u32 *out_indices, bool wide, u32 shift, u32 *cursor, u32 begin, u32 end)
+{
+    u32 i;
+    for (i = begin; i < end; i++)
+    {
+        u32 slot = cursor[morton_digit(keys, wide, i, shift)]++;
+        if (wide)
+        {
+            ((u64 *)out_keys)[slot] = ((const u64 *)keys)[i];
+        }
+        else
+        {
+            ((u32 *)out_keys)[slot] = ((const u32 *)keys)[i];
+        }
+        out_indices[slot] = indices[i];
+    }
+}
+
+/* Shared serial implementation of morton_sort30/morton_sort63. */
+static void morton_radix_sort(void *codes, bool wide, u32 *indices, void *scratch_codes, u32 *scratch_indices, u32 count, u32 passes)
+{
+    u32 histogram[256];
+    void *keys = codes, *out_keys = scratch_codes;
+    u32 *ids = indices, *out_ids = scratch_indices;
+    u32 key_size = wide ? sizeof(u64) : sizeof(u32);
+    u32 pass, i;
+
+    for (i = 0; i < count; i++)
+    {
+        indices[i] = i;
+    }
+    for (pass = 0; pass < passes; pass++)
+    {
+        u32 shift = pass * 8;
+        u32 running = 0;
+        void *swap_keys;
+        u32 *swap_ids;
+        memset(histogram, 0, sizeof(histogram));
+        for (i = 0; i < count; i++)
+        {
+            histogram[morton_digit(keys, wide, i, shift)]++;
+        }
+        if (count == 0 || histogram[morton_digit(keys, wide, 0, shift)] == count)
+        {
+            continue;
+        }
+        for (i = 0; i < 256; i++)
+        {
+            u32 digit_count = histogram[i];
+            histogram[i] = running;
+            running += digit_count;
+        }
+        morton_scatter(keys, ids, out_keys, out_ids, wide, shift, histogram, 0, count);
+        swap_keys = keys; keys = out_keys; out_keys = swap_keys;
+        swap_ids = ids; ids = out_ids; out_ids = swap_ids;
+    }
+    if (keys != codes)
+    {
+        memcpy(codes, keys, (size_t)count * key_size);
+        memcpy(indices, ids, (size_t)count * sizeof(u32));
+    }
+}
+
+/* Sort 30-bit codes ascending; indices receives the original index of each sorted code. */
+static void morton_sort30(u32 *codes, u32 *indices, u32 *scratch_codes, u32 *scratch_indices, u32 count)
+{
+    morton_radix_sort(codes, BOOL(0), indices, scratch_codes, scratch_indices, count, 4);
+}
+
+/* Sort 63-bit codes ascending; indices receives the original index of each sorted code. */
+static void morton_sort63(u64 *codes, u32 *indices, u64 *scratch_codes, u32 *scratch_indices, u32 count)
+{
+    morton_radix_sort(codes, BOOL(1), indices, scratch_codes, scratch_indices, count, 8);
+}
+
+/* Gather vec3 into sorted order: dst[i] = src[indices[i]] (dst must not alias src). */
+static void vec3_gather_array(const vec3 *src, const u32 *indices, vec3 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = src[indices[i]];
+    }
+}
+
+/* Gather any payload of `stride` bytes per element into sorted order (dst must not alias src). */
+static void morton_gather(const void *src, u32 stride, const u32 *indices, void *dst, u32 count)
+{
+    const u8 *from = (const u8 *)src;
+    u8 *to = (u8 *)dst;
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        memcpy(to + (size_t)i * stride, from + (size_t)indices[i] * stride, stride);
+    }
+}
+
+#if defined(VECTORS_PARALLEL_H)
+/* -------------------------------------------------------------------------
+   Parallel radix sort - one block of keys per worker. Each pass builds a
+   histogram per block in parallel, turns them into per-block write cursors
+   (digit-major, so the sort stays stable) and scatters the blocks in
+   parallel. Falls back to the serial sort if scratch allocation fails.
+   ------------------------------------------------------------------------- */
+
+typedef struct morton_sort_pass
+{
+    const void *keys;
+    const u32 *indices;
+    void *out_keys;
+    u32 *out_indices;
+    bool wide;
+    u32 shift;
+    u32 block_size;
+    u32 *histograms;    /* 256 entries per block */
+} morton_sort_pass;
+
+static void morton_histogram_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    morton_sort_pass *pass = (morton_sort_pass *)user;
+    u32 *histogram = pass->histograms + (begin / pass->block_size) * 256;
+    u32 i;
+    (void)worker;
+    for (i = begin; i < end; i++)
+    {
+        histogram[morton_digit(pass->keys, pass->wide, i, pass->shift)]++;
+    }
+}
+
+static void morton_scatter_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    morton_sort_pass *pass = (morton_sort_pass *)user;
+    (void)worker;
+    morton_scatter(pass->keys, pass->indices, pass->out_keys, pass->out_indices, pass->wide, pass->shift,
+                   pass->histograms + (begin / pass->block_size) * 256, begin, end);
+}
+
+/* Shared parallel implementation of morton_sort30_parallel/morton_sort63_parallel. */
+static void morton_radix_sort_parallel(parallel_pool *pool, void *codes, bool wide, u32 *indices, void *scratch_codes, u32 *scratch_indices, u32 count, u32 passes)
+{
+    u32 block_count = pool != NULL ? pool->worker_count : 1;
+    u32 key_size = wide ? sizeof(u64) : sizeof(u32);
+    morton_sort_pass pass;
+    void *swap_keys;
+    u32 *swap_ids;
+    u32 p, i;
+
+    pass.block_size = count / block_count + 1;
+    pass.histograms = (u32 *)malloc((size_t)block_count * 256 * sizeof(u32));
+    if (pass.histograms == NULL || block_count <= 1)
+    {
+        free(pass.histograms);
+        morton_radix_sort(codes, wide, indices, scratch_codes, scratch_indices, count, passes);
+        return;
+    }
+    for (i = 0; i < count; i++)
+    {
+        indices[i] = i;
+    }
+    pass.keys = codes;
+    pass.indices = indices;
+    pass.out_keys = scratch_codes;
+    pass.out_indices = scratch_indices;
+    pass.wide = wide;
+    for (p = 0; p < passes; p++)
+    {
+        u32 running = 0;
+        u32 digit, block;
+        bool single_digit;
+        pass.shift = p * 8;
+        memset(pass.histograms, 0, (size_t)block_count * 256 * sizeof(u32));
+        parallel_for(pool, count, pass.block_size, morton_histogram_task, &pass);
+
+        /* Exclusive prefix over (digit, block) turns the histograms into write cursors. */
+        single_digit = BOOL(count == 0);
+        for (digit = 0; digit < 256; digit++)
+        {
+            u32 digit_total = 0;
+            for (block = 0; block < block_count; block++)
+            {
+                u32 block_count_of_digit = pass.histograms[block * 256 + digit];
+                pass.histograms[block * 256 + digit] = running + digit_total;
+                digit_total += block_count_of_digit;
+            }
+            single_digit = BOOL(single_digit || digit_total == count);
+            running += digit_total;
+        }
+        if (single_digit)
+        {
+            continue;
+        }
+        parallel_for(pool, count, pass.block_size, morton_scatter_task, &pass);
+        swap_keys = (void *)pass.keys; pass.keys = pass.out_keys; pass.out_keys = swap_keys;
+        swap_ids = (u32 *)pass.indices; pass.indices = pass.out_indices; pass.out_indices = swap_ids;
+    }
+    if (pass.keys != codes)
+    {
+        memcpy(codes, pass.keys, (size_t)count * key_size);
+        memcpy(indices, pass.indices, (size_t)count * sizeof(u32));
+    }
+    free(pass.histograms);
+}
+
+/* Parallel morton_sort30 (same result). */
+static void morton_sort30_parallel(parallel_pool *pool, u32 *codes, u32 *indices, u32 *scratch_codes, u32 *scratch_indices, u32 count)
+{
+    morton_radix_sort_parallel(pool, codes, BOOL(0), indices, scratch_codes, scratch_indices, count, 4);
+}
+
+/* Parallel morton_sort63 (same result). */
+static void morton_sort63_parallel(parallel_pool *pool, u64 *codes, u32 *indices, u64 *scratch_codes, u32 *scratch_indices, u32 count)
+{
+    morton_radix_sort_parallel(pool, codes, BOOL(1), indices, scratch_codes, scratch_indices, count, 8);
+}
+#endif /* VECTORS_PARALLEL_H */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_MORTON_H */
@@ -0,0 +1,1231 @@
+#if !defined(VECTORS_NOISE_H)
+#define VECTORS_NOISE_H
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_NOISE_NO_SIMD       evaluate the *_array forms one point at a
+                                time even when SSE2 or AVX2 is available.
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_NOISE_NO_SIMD)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define VECTORS_NOISE_LANES 8
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define VECTORS_NOISE_LANES 4
+    #endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Noise - deterministic lattice noise. Every lattice point's random value
+   comes from an integer hash of its coordinates and a seed (no permutation
+   table), so results are identical across platforms and seeds are free.
+   Output ranges:
+       value, Perlin, simplex      about [-1, 1]
+       Worley                      (F1, F2) distances to the nearest and
+                                   second-nearest feature point, >= 0
+       fBm                         about [-1, 1] (normalized by amplitude)
+   ------------------------------------------------------------------------- */
+
+/* Avalanche a 32-bit integer (lowbias32). */
+static u32 noise_hash(u32 x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Per-call hash base of a seed; lattice hashes chain the coordinates onto it. */
+static u32 noise_seed(u32 seed)
+{
+    return noise_hash(seed + 0x9e3779b9u);
+}
+
+static u32 noise_hash2(u32 base, i32 x, i32 y)
+{
+    return noise_hash(noise_hash(base ^ (u32)x) ^ (u32)y);
+}
+
+static u32 noise_hash3(u32 base, i32 x, i32 y, i32 z)
+{
+    return noise_hash(noise_hash(noise_hash(base ^ (u32)x) ^ (u32)y) ^ (u32)z);
+}
+
+static u32 noise_hash4(u32 base, i32 x, i32 y, i32 z, i32 w)
+{
+    return noise_hash(noise_hash(noise_hash(noise_hash(base ^ (u32)x) ^ (u32)y) ^ (u32)z) ^ (u32)w);
+}
+
+/* Hash to [-1, 1]. */
+static real noise_unit(u32 hash)
+{
+    return (real)(hash >> 8) * (2.0f / 16777215.0f) - 1.0f;
+}
+
+/* Quintic fade 6t^5 - 15t^4 + 10t^3 (zero first and second derivative at the lattice). */
+static real noise_fade(real t)
+{
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+static real noise_lerp(real a, real b, real t)
+{
+    return a + (b - a) * t;
+}
+
+/* Gradient sets: 2D square directions, Perlin's 12 cube edges (padded to 16), and the 32 4D edges. */
+static const real noise_gradients2[8][2] =
+{
+    { 1, 1 }, { -1, 1 }, { 1, -1 }, { -1, -1 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 }
+};
+
+static const real noise_gradients3[16][3] =
+{
+    { 1, 1, 0 }, { -1, 1, 0 }, { 1, -1, 0 }, { -1, -1, 0 },
+    { 1, 0, 1 }, { -1, 0, 1 }, { 1, 0, -1 }, { -1, 0, -1 },
+    { 0, 1, 1 }, { 0, -1, 1 }, { 0, 1, -1 }, { 0, -1, -1 },
+    { 1, 1, 0 }, { -1, 1, 0 }, { 0, -1, 1 }, { 0, -1, -1 }
+};
+
+static const real noise_gradients4[32][4] =
+{
+    { 0, 1, 1, 1 }, { 0, 1, 1, -1 }, { 0, 1, -1, 1 }, { 0, 1, -1, -1 },
+    { 0, -1, 1, 1 }, { 0, -1, 1, -1 }, { 0, -1, -1, 1 }, { 0, -1, -1, -1 },
+    { 1, 0, 1, 1 }, { 1, 0, 1, -1 }, { 1, 0, -1, 1 }, { 1, 0, -1, -1 },
+    { -1, 0, 1, 1 }, { -1, 0, 1, -1 }, { -1, 0, -1, 1 }, { -1, 0, -1, -1 },
+    { 1, 1, 0, 1 }, { 1, 1, 0, -1 }, { 1, -1, 0, 1 }, { 1, -1, 0, -1 },
+    { -1, 1, 0, 1 }, { -1, 1, 0, -1 }, { -1, -1, 0, 1 }, { -1, -1, 0, -1 },
+    { 1, 1, 1, 0 }, { 1, 1, -1, 0 }, { 1, -1, 1, 0 }, { 1, -1, -1, 0 },
+    { -1, 1, 1, 0 }, { -1, 1, -1, 0 }, { -1, -1, 1, 0 }, { -1, -1, -1, 0 }
+};
+
+static real noise_gradient2(u32 hash, real x, real y)
+{
+    const real *g = noise_gradients2[hash & 7];
+    return g[0] * x + g[1] * y;
+}
+
+static real noise_gradient3(u32 hash, real x, real y, real z)
+{
+    const real *g = noise_gradients3[hash & 15];
+    return g[0] * x + g[1] * y + g[2] * z;
+}
+
+static real noise_gradient4(u32 hash, real x, real y, real z, real w)
+{
+    const real *g = noise_gradients4[hash & 31];
+    return g[0] * x + g[1] * y + g[2] * z + g[3] * w;
+}
+
+/* ---- value noise ---- */
+
+/* Value noise: random values at the lattice, quintic interpolation between them. */
+static real noise_value2(vec2 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec2 cell = ivec2_from_vec2_floor(point);
+    vec2 f = vec2_frac(point);
+    i32 x = cell.components[0], y = cell.components[1];
+    real u = noise_fade(f.components[0]), v = noise_fade(f.components[1]);
+    real bottom = noise_lerp(noise_unit(noise_hash2(base, x, y)), noise_unit(noise_hash2(base, x + 1, y)), u);
+    real top = noise_lerp(noise_unit(noise_hash2(base, x, y + 1)), noise_unit(noise_hash2(base, x + 1, y + 1)), u);
+    return noise_lerp(bottom, top, v);
+}
+
+static real noise_value3(vec3 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec3 cell = ivec3_from_vec3_floor(point);
+    vec3 f = vec3_frac(point);
+    i32 x = cell.components[0], y = cell.components[1], z = cell.components[2];
+    real u = noise_fade(f.components[0]), v = noise_fade(f.components[1]), w = noise_fade(f.components[2]);
+    real x00 = noise_lerp(noise_unit(noise_hash3(base, x, y, z)), noise_unit(noise_hash3(base, x + 1, y, z)), u);
+    real x10 = noise_lerp(noise_unit(noise_hash3(base, x, y + 1, z)), noise_unit(noise_hash3(base, x + 1, y + 1, z)), u);
+    real x01 = noise_lerp(noise_unit(noise_hash3(base, x, y, z + 1)), noise_unit(noise_hash3(base, x + 1, y, z + 1)), u);
+    real x11 = noise_lerp(noise_unit(noise_hash3(base, x, y + 1, z + 1)), noise_unit(noise_hash3(base, x + 1, y + 1, z + 1)), u);
+    return noise_lerp(noise_lerp(x00, x10, v), noise_lerp(x01, x11, v), w);
+}
+
+/* ---- Perlin noise ---- */
+
+/* Classic (improved) Perlin gradient noise. */
+static real noise_perlin2(vec2 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec2 cell = ivec2_from_vec2_floor(point);
+    vec2 f = vec2_frac(point);
+    i32 x = cell.components[0], y = cell.components[1];
+    real fx = f.components[0], fy = f.components[1];
+    real u = noise_fade(fx), v = noise_fade(fy);
+    real bottom = noise_lerp(noise_gradient2(noise_hash2(base, x, y), fx, fy), noise_gradient2(noise_hash2(base, x + 1, y), fx - 1.0f, fy), u);
+    real top = noise_lerp(noise_gradient2(noise_hash2(base, x, y + 1), fx, fy - 1.0f), noise_gradient2(noise_hash2(base, x + 1, y + 1), fx - 1.0f, fy - 1.0f), u);
+    return noise_lerp(bottom, top, v);
+}
+
+static real noise_perlin3(vec3 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec3 cell = ivec3_from_vec3_floor(point);
+    vec3 f = vec3_frac(point);
+    i32 x = cell.components[0], y = cell.components[1], z = cell.components[2];
+    real fx = f.components[0], fy = f.components[1], fz = f.components[2];
+    real u = noise_fade(fx), v = noise_fade(fy), w = noise_fade(fz);
+    real x00 = noise_lerp(noise_gradient3(noise_hash3(base, x, y, z), fx, fy, fz),
+                          noise_gradient3(noise_hash3(base, x + 1, y, z), fx - 1.0f, fy, fz), u);
+    real x10 = noise_lerp(noise_gradient3(noise_hash3(base, x, y + 1, z), fx, fy - 1.0f, fz),
+                          noise_gradient3(noise_hash3(base, x + 1, y + 1, z), fx - 1.0f, fy - 1.0f, fz), u);
+    real x01 = noise_lerp(noise_gradient3(noise_hash3(base, x, y, z + 1), fx, fy, fz - 1.0f),
+                          noise_gradient3(noise_hash3(base, x + 1, y, z + 1), fx - 1.0f, fy, fz - 1.0f), u);
+    real x11 = noise_lerp(noise_gradient3(noise_hash3(base, x, y + 1, z + 1), fx, fy - 1.0f, fz - 1.0f),
+                          noise_gradient3(noise_hash3(base, x + 1, y + 1, z + 1), fx - 1.0f, fy - 1.0f, fz - 1.0f), u);
+    return noise_lerp(noise_lerp(x00, x10, v), noise_lerp(x01, x11, v), w);
+}
+
+static real noise_perlin4(vec4 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec4 cell = ivec4_from_vec4_floor(point);
+    vec4 f = vec4_frac(point);
+    real fade[4];
+    real corners[16];
+    u32 corner, axis, width;
+    for (axis = 0; axis < 4; axis++)
+    {
+        fade[axis] = noise_fade(f.components[axis]);
+    }
+    for (corner = 0; corner < 16; corner++)
+    {
+        i32 offset[4];
+        for (axis = 0; axis < 4; axis++)
+        {
+            offset[axis] = (i32)((corner >> axis) & 1);
+        }
+        corners[corner] = noise_gradient4(noise_hash4(base, cell.components[0] + offset[0], cell.components[1] + offset[1],
+                                                      cell.components[2] + offset[2], cell.components[3] + offset[3]),
+                                          f.components[0] - (real)offset[0], f.components[1] - (real)offset[1],
+                                          f.components[2] - (real)offset[2], f.components[3] - (real)offset[3]);
+    }
+    /* Collapse one axis at a time: corners 2k and 2k + 1 differ only in the lowest remaining axis. */
+    for (axis = 0, width = 16; axis < 4; axis++, width /= 2)
+    {
+        for (corner = 0; corner < width / 2; corner++)
+        {
+            corners[corner] = noise_lerp(corners[2 * corner], corners[2 * corner + 1], fade[axis]);
+        }
+    }
+    return corners[0];
+}
+
+/* ---- simplex noise ---- */
+
+/* Simplex noise (Perlin 2001, after Gustavson's formulation): sums radial falloffs from the corners of the
+   simplex containing the point, so cost grows linearly with dimension instead of exponentially. */
+static real noise_simplex2(vec2 point, u32 seed)
+{
+    static const real skew = 0.36602540378f;        /* (sqrt(3) - 1) / 2 */
+    static const real unskew = 0.21132486540f;      /* (3 - sqrt(3)) / 6 */
+    u32 base = noise_seed(seed);
+    real x = point.components[0], y = point.components[1];
+    real s = (x + y) * skew;
+    i32 i = (i32)real_floor(x + s), j = (i32)real_floor(y + s);
+    real t = (real)(i + j) * unskew;
+    real x0 = x - ((real)i - t), y0 = y - ((real)j - t);
+    i32 i1 = x0 > y0 ? 1 : 0, j1 = 1 - i1;
+    real offsets[3][2];
+    i32 lattice[3][2];
+    real sum = 0.0f;
+    u32 corner;
+
+    offsets[0][0] = x0;                             offsets[0][1] = y0;
+    offsets[1][0] = x0 - (real)i1 + unskew;         offsets[1][1] = y0 - (real)j1 + unskew;
+    offsets[2][0] = x0 - 1.0f + 2.0f * unskew;      offsets[2][1] = y0 - 1.0f + 2.0f * unskew;
+    lattice[0][0] = i;          lattice[0][1] = j;
+    lattice[1][0] = i + i1;     lattice[1][1] = j + j1;
+    lattice[2][0] = i + 1;      lattice[2][1] = j + 1;
+    for (corner = 0; corner < 3; corner++)
+    {
+        real dx = offsets[corner][0], dy = offsets[corner][1];
+        real falloff = 0.5f - dx * dx - dy * dy;
+        if (falloff > 0.0f)
+        {
+            falloff *= falloff;
+            sum += falloff * falloff * noise_gradient2(noise_hash2(base, lattice[corner][0], lattice[corner][1]), dx, dy);
+        }
+    }
+    return 70.0f * sum;
+}
+
+static real noise_simplex3(vec3 point, u32 seed)
+{
+    static const real skew = 1.0f / 3.0f;
+    static const real unskew = 1.0f / 6.0f;
+    u32 base = noise_seed(seed);
+    real x = point.components[0], y = point.components[1], z = point.components[2];
+    real s = (x + y + z) * skew;
+    i32 i = (i32)real_floor(x + s), j = (i32)real_floor(y + s), k = (i32)real_floor(z + s);
+    real t = (real)(i + j + k) * unskew;
+    real x0 = x - ((real)i - t), y0 = y - ((real)j - t), z0 = z - ((real)k - t);
+    i32 step[4][3];
+    real sum = 0.0f;
+    u32 corner;
+
+    /* Walk from the origin corner to the far corner along the axes in decreasing order of offset. */
+    step[0][0] = 0; step[0][1] = 0; step[0][2] = 0;
+    step[3][0] = 1; step[3][1] = 1; step[3][2] = 1;
+    step[1][0] = (x0 >= y0 && x0 >= z0) ? 1 : 0;
+    step[1][1] = (!step[1][0] && y0 >= z0) ? 1 : 0;
+    step[1][2] = (!step[1][0] && !step[1][1]) ? 1 : 0;
+    step[2][0] = (x0 >= y0 || x0 >= z0) ? 1 : 0;
+    step[2][1] = (y0 > x0 || y0 >= z0) ? 1 : 0;
+    step[2][2] = (z0 > x0 || z0 > y0) ? 1 : 0;
+    for (corner = 0; corner < 4; corner++)
+    {
+        real offset = (real)corner * unskew;
+        real dx = x0 - (real)step[corner][0] + offset;
+        real dy = y0 - (real)step[corner][1] + offset;
+        real dz = z0 - (real)step[corner][2] + offset;
+        real falloff = 0.6f - dx * dx - dy * dy - dz * dz;
+        if (falloff > 0.0f)
+        {
+            falloff *= falloff;
+            sum += falloff * falloff * noise_gradient3(noise_hash3(base, i + step[corner][0], j + step[corner][1], k + step[corner][2]), dx, dy, dz);
+        }
+    }
+    return 32.0f * sum;
+}
+
+static real noise_simplex4(vec4 point, u32 seed)
+{
+    static const real skew = 0.30901699437f;        /* (sqrt(5) - 1) / 4 */
+    static const real unskew = 0.13819660113f;      /* (5 - sqrt(5)) / 20 */
+    u32 base = noise_seed(seed);
+    real s = (point.components[0] + point.components[1] + point.components[2] + point.components[3]) * skew;
+    i32 cell[4];
+    real origin[4];
+    u32 rank[4] = { 0, 0, 0, 0 };
+    real t = 0.0f;
+    real sum = 0.0f;
+    u32 axis, other, corner;
+
+    for (axis = 0; axis < 4; axis++)
+    {
+        cell[axis] = (i32)real_floor(point.components[axis] + s);
+        t += (real)cell[axis];
+    }
+    t *= unskew;
+    for (axis = 0; axis < 4; axis++)
+    {
+        origin[axis] = point.components[axis] - ((real)cell[axis] - t);
+    }
+    /* Rank the offsets; corner c of the simplex steps along every axis whose rank is >= 4 - c. */
+    for (axis = 0; axis < 4; axis++)
+    {
+        for (other = axis + 1; other < 4; other++)
+        {
+            if (origin[axis] > origin[other])
+            {
+                rank[axis]++;
+            }
+            else
+            {
+                rank[other]++;
+            }
+        }
+    }
+    for (corner = 0; corner < 5; corner++)
+    {
+        i32 step[4];
+        real delta[4];
+        real falloff = 0.6f;
+        for (axis = 0; axis < 4; axis++)
+        {
+            step[axis] = rank[axis] + corner >= 4 ? 1 : 0;
+            delta[axis] = origin[axis] - (real)step[axis] + (real)corner * unskew;
+            falloff -= delta[axis] * delta[axis];
+        }
+        if (falloff > 0.0f)
+        {
+            falloff *= falloff;
+            sum += falloff * falloff * noise_gradient4(noise_hash4(base, cell[0] + step[0], cell[1] + step[1], cell[2] + step[2], cell[3] + step[3]),
+                                                       delta[0], delta[1], delta[2], delta[3]);
+        }
+    }
+    return 27.0f * sum;
+}
+
+/* ---- Worley noise ---- */
+
+/* Worley (cellular) noise: one hashed feature point per cell; returns (F1, F2). */
+static vec2 noise_worley2(vec2 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec2 cell = ivec2_from_vec2_floor(point);
+    real nearest = 1e30f, second = 1e30f;
+    i32 dx, dy;
+    for (dy = -1; dy <= 1; dy++)
+    for (dx = -1; dx <= 1; dx++)
+    {
+        i32 x = cell.components[0] + dx, y = cell.components[1] + dy;
+        u32 hash = noise_hash2(base, x, y);
+        real px = (real)x + (real)(hash & 0xffff) * (1.0f / 65536.0f) - point.components[0];
+        real py = (real)y + (real)(hash >> 16) * (1.0f / 65536.0f) - point.components[1];
+        real distance_squared = px * px + py * py;
+        second = distance_squared < nearest ? nearest : (distance_squared < second ? distance_squared : second);
+        nearest = distance_squared < nearest ? distance_squared : nearest;
+    }
+    return vec2_init_from_2(real_sqrt(nearest), real_sqrt(second));
+}
+
+static vec2 noise_worley3(vec3 point, u32 seed)
+{
+    u32 base = noise_seed(seed);
+    ivec3 cell = ivec3_from_vec3_floor(point);
+    real nearest = 1e30f, second = 1e30f;
+    i32 dx, dy, dz;
+    for (dz = -1; dz <= 1; dz++)
+    for (dy = -1; dy <= 1; dy++)
+    for (dx = -1; dx <= 1; dx++)
+    {
+        i32 x = cell.components[0] + dx, y = cell.components[1] + dy, z = cell.components[2] + dz;
+        u32 hash = noise_hash3(base, x, y, z);
+        real px = (real)x + (real)(hash & 0x7ff) * (1.0f / 2048.0f) - point.components[0];
+        real py = (real)y + (real)((hash >> 11) & 0x7ff) * (1.0f / 2048.0f) - point.components[1];
+        real pz = (real)z + (real)(hash >> 22) * (1.0f / 1024.0f) - point.components[2];
+        real distance_squared = px * px + py * py + pz * pz;
+        second = distance_squared < nearest ? nearest : (distance_squared < second ? distance_squared : second);
+        nearest = distance_squared < nearest ? distance_squared : nearest;
+    }
+    return vec2_init_from_2(real_sqrt(nearest), real_sqrt(second));
+}
+
+/* ---- fractal Brownian motion ---- */
+
+/* fBm of simplex noise: `octaves` layers, each `lacunarity` times the frequency and `gain` times the
+   amplitude of the previous one, with its own seed; normalized by the total amplitude. */
+static real noise_fbm2(vec2 point, u32 octaves, real lacunarity, real gain, u32 seed)
+{
+    real sum = 0.0f, amplitude = 1.0f, total = 0.0f;
+    u32 octave;
+    for (octave = 0; octave < octaves; octave++)
+    {
+        sum += amplitude * noise_simplex2(point, seed + octave);
+        total += amplitude;
+        amplitude *= gain;
+        point = vec2_mul_scalar(point, lacunarity);
+    }
+    return total > 0.0f ? sum / total : 0.0f;
+}
+
+static real noise_fbm3(vec3 point, u32 octaves, real lacunarity, real gain, u32 seed)
+{
+    real sum = 0.0f, amplitude = 1.0f, total = 0.0f;
+    u32 octave;
+    for (octave = 0; octave < octaves; octave++)
+    {
+        sum += amplitude * noise_simplex3(point, seed + octave);
+        total += amplitude;
+        amplitude *= gain;
+        point = vec3_mul_scalar(point, lacunarity);
+    }
+    return total > 0.0f ? sum / total : 0.0f;
+}
+
+/* ---- SIMD lanes ---- */
+
+#if defined(VECTORS_NOISE_LANES)
+
+/* VECTORS_NOISE_LANES points at once, one per lane. The lane kernels repeat the scalar functions'
+   operations in the same order; gradients come from the hash bits through selects, and the 32-bit
+   hash multiplies are emulated on SSE2. */
+#if VECTORS_NOISE_LANES == 8
+typedef __m256 noise_lanes;
+typedef __m256i noise_lanes_u32;
+
+static noise_lanes noise_lanes_set(real value)                      { return _mm256_set1_ps(value); }
+static noise_lanes noise_lanes_load(const real *src)                { return _mm256_loadu_ps(src); }
+static void noise_lanes_store(real *dst, noise_lanes value)         { _mm256_storeu_ps(dst, value); }
+static noise_lanes noise_lanes_add(noise_lanes a, noise_lanes b)    { return _mm256_add_ps(a, b); }
+static noise_lanes noise_lanes_sub(noise_lanes a, noise_lanes b)    { return _mm256_sub_ps(a, b); }
+static noise_lanes noise_lanes_mul(noise_lanes a, noise_lanes b)    { return _mm256_mul_ps(a, b); }
+static noise_lanes noise_lanes_div(noise_lanes a, noise_lanes b)    { return _mm256_div_ps(a, b); }
+static noise_lanes noise_lanes_sqrt(noise_lanes a)                  { return _mm256_sqrt_ps(a); }
+static noise_lanes noise_lanes_and(noise_lanes a, noise_lanes b)    { return _mm256_and_ps(a, b); }
+static noise_lanes noise_lanes_or(noise_lanes a, noise_lanes b)     { return _mm256_or_ps(a, b); }
+static noise_lanes noise_lanes_xor(noise_lanes a, noise_lanes b)    { return _mm256_xor_ps(a, b); }
+static noise_lanes noise_lanes_less(noise_lanes a, noise_lanes b)   { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static noise_lanes noise_lanes_less_equal(noise_lanes a, noise_lanes b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static noise_lanes noise_lanes_select(noise_lanes mask, noise_lanes a, noise_lanes b) { return _mm256_blendv_ps(b, a, mask); }
+static noise_lanes noise_lanes_from_i32(noise_lanes_u32 a)          { return _mm256_cvtepi32_ps(a); }
+static noise_lanes_u32 noise_lanes_truncate(noise_lanes a)          { return _mm256_cvttps_epi32(a); }
+static noise_lanes noise_lanes_cast(noise_lanes_u32 a)              { return _mm256_castsi256_ps(a); }
+static noise_lanes_u32 noise_lanes_bits(noise_lanes a)              { return _mm256_castps_si256(a); }
+
+static noise_lanes_u32 noise_lanes_u32_set(u32 value)               { return _mm256_set1_epi32((int)value); }
+static noise_lanes_u32 noise_lanes_u32_add(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_add_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_sub(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_sub_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_xor(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_xor_si256(a, b); }
+static noise_lanes_u32 noise_lanes_u32_and(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_and_si256(a, b); }
+static noise_lanes_u32 noise_lanes_u32_or(noise_lanes_u32 a, noise_lanes_u32 b)  { return _mm256_or_si256(a, b); }
+static noise_lanes_u32 noise_lanes_u32_equal(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_cmpeq_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_i32_greater(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm256_cmpgt_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_shift_left(noise_lanes_u32 a, u32 bits)  { return _mm256_sll_epi32(a, _mm_cvtsi32_si128((int)bits)); }
+static noise_lanes_u32 noise_lanes_u32_shift_right(noise_lanes_u32 a, u32 bits) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128((int)bits)); }
+static noise_lanes_u32 noise_lanes_u32_mul(noise_lanes_u32 a, u32 factor)       { return _mm256_mullo_epi32(a, _mm256_set1_epi32((int)factor)); }
+#else
+typedef __m128 noise_lanes;
+typedef __m128i noise_lanes_u32;
+
+static noise_lanes noise_lanes_set(real value)                      { return _mm_set1_ps(value); }
+static noise_lanes noise_lanes_load(const real *src)                { return _mm_loadu_ps(src); }
+static void noise_lanes_store(real *dst, noise_lanes value)         { _mm_storeu_ps(dst, value); }
+static noise_lanes noise_lanes_add(noise_lanes a, noise_lanes b)    { return _mm_add_ps(a, b); }
+static noise_lanes noise_lanes_sub(noise_lanes a, noise_lanes b)    { return _mm_sub_ps(a, b); }
+static noise_lanes noise_lanes_mul(noise_lanes a, noise_lanes b)    { return _mm_mul_ps(a, b); }
+static noise_lanes noise_lanes_div(noise_lanes a, noise_lanes b)    { return _mm_div_ps(a, b); }
+static noise_lanes noise_lanes_sqrt(noise_lanes a)                  { return _mm_sqrt_ps(a); }
+static noise_lanes noise_lanes_and(noise_lanes a, noise_lanes b)    { return _mm_and_ps(a, b); }
+static noise_lanes noise_lanes_or(noise_lanes a, noise_lanes b)     { return _mm_or_ps(a, b); }
+static noise_lanes noise_lanes_xor(noise_lanes a, noise_lanes b)    { return _mm_xor_ps(a, b); }
+static noise_lanes noise_lanes_less(noise_lanes a, noise_lanes b)   { return _mm_cmplt_ps(a, b); }
+static noise_lanes noise_lanes_less_equal(noise_lanes a, noise_lanes b) { return _mm_cmple_ps(a, b); }
+static noise_lanes noise_lanes_select(noise_lanes mask, noise_lanes a, noise_lanes b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+static noise_lanes noise_lanes_from_i32(noise_lanes_u32 a)          { return _mm_cvtepi32_ps(a); }
+static noise_lanes_u32 noise_lanes_truncate(noise_lanes a)          { return _mm_cvttps_epi32(a); }
+static noise_lanes noise_lanes_cast(noise_lanes_u32 a)              { return _mm_castsi128_ps(a); }
+static noise_lanes_u32 noise_lanes_bits(noise_lanes a)              { return _mm_castps_si128(a); }
+
+static noise_lanes_u32 noise_lanes_u32_set(u32 value)               { return _mm_set1_epi32((int)value); }
+static noise_lanes_u32 noise_lanes_u32_add(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_add_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_sub(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_sub_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_xor(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_xor_si128(a, b); }
+static noise_lanes_u32 noise_lanes_u32_and(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_and_si128(a, b); }
+static noise_lanes_u32 noise_lanes_u32_or(noise_lanes_u32 a, noise_lanes_u32 b)  { return _mm_or_si128(a, b); }
+static noise_lanes_u32 noise_lanes_u32_equal(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_cmpeq_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_i32_greater(noise_lanes_u32 a, noise_lanes_u32 b) { return _mm_cmpgt_epi32(a, b); }
+static noise_lanes_u32 noise_lanes_u32_shift_left(noise_lanes_u32 a, u32 bits)  { return _mm_sll_epi32(a, _mm_cvtsi32_si128((int)bits)); }
+static noise_lanes_u32 noise_lanes_u32_shift_right(noise_lanes_u32 a, u32 bits) { return _mm_srl_epi32(a, _mm_cvtsi32_si128((int)bits)); }
+
+/* SSE2 has no 32-bit low multiply: multiply the even and odd lanes as 64-bit products and interleave. */
+static noise_lanes_u32 noise_lanes_u32_mul(noise_lanes_u32 a, u32 factor)
+{
+    __m128i scale = _mm_set1_epi32((int)factor);
+    __m128i even = _mm_mul_epu32(a, scale);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), scale);
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+#endif
+
+/* One component of VECTORS_NOISE_LANES consecutive points, `stride` reals apart. */
+static noise_lanes noise_lanes_gather(const real *src, u32 stride)
+{
+    real lanes[VECTORS_NOISE_LANES];
+    u32 n;
+    for (n = 0; n < VECTORS_NOISE_LANES; n++)
+    {
+        lanes[n] = src[n * stride];
+    }
+    return noise_lanes_load(lanes);
+}
+
+/* Same as ivec*_from_vec*_floor: truncate, then step down where that rounded up. */
+static noise_lanes_u32 noise_lanes_floor(noise_lanes a)
+{
+    noise_lanes_u32 cell = noise_lanes_truncate(a);
+    return noise_lanes_u32_add(cell, noise_lanes_bits(noise_lanes_less(a, noise_lanes_from_i32(cell))));
+}
+
+/* All-ones in the lanes whose hash has `bit` set. */
+static noise_lanes noise_lanes_bit(noise_lanes_u32 hash, u32 bit)
+{
+    noise_lanes_u32 mask = noise_lanes_u32_set(bit);
+    return noise_lanes_cast(noise_lanes_u32_equal(noise_lanes_u32_and(hash, mask), mask));
+}
+
+/* Negate the lanes whose hash has bit `index` set, by moving that bit into the sign. */
+static noise_lanes noise_lanes_negate_if(noise_lanes a, noise_lanes_u32 hash, u32 index)
+{
+    noise_lanes_u32 sign = noise_lanes_u32_shift_left(noise_lanes_u32_and(hash, noise_lanes_u32_set(1u << index)), 31 - index);
+    return noise_lanes_xor(a, noise_lanes_cast(sign));
+}
+
+static noise_lanes_u32 noise_lanes_hash(noise_lanes_u32 x)
+{
+    x = noise_lanes_u32_xor(x, noise_lanes_u32_shift_right(x, 16));
+    x = noise_lanes_u32_mul(x, 0x7feb352du);
+    x = noise_lanes_u32_xor(x, noise_lanes_u32_shift_right(x, 15));
+    x = noise_lanes_u32_mul(x, 0x846ca68bu);
+    x = noise_lanes_u32_xor(x, noise_lanes_u32_shift_right(x, 16));
+    return x;
+}
+
+static noise_lanes_u32 noise_lanes_hash2(u32 base, noise_lanes_u32 x, noise_lanes_u32 y)
+{
+    return noise_lanes_hash(noise_lanes_u32_xor(noise_lanes_hash(noise_lanes_u32_xor(noise_lanes_u32_set(base), x)), y));
+}
+
+static noise_lanes_u32 noise_lanes_hash3(u32 base, noise_lanes_u32 x, noise_lanes_u32 y, noise_lanes_u32 z)
+{
+    return noise_lanes_hash(noise_lanes_u32_xor(noise_lanes_hash2(base, x, y), z));
+}
+
+static noise_lanes_u32 noise_lanes_hash4(u32 base, noise_lanes_u32 x, noise_lanes_u32 y, noise_lanes_u32 z, noise_lanes_u32 w)
+{
+    return noise_lanes_hash(noise_lanes_u32_xor(noise_lanes_hash3(base, x, y, z), w));
+}
+
+static noise_lanes noise_lanes_unit(noise_lanes_u32 hash)
+{
+    noise_lanes value = noise_lanes_from_i32(noise_lanes_u32_shift_right(hash, 8));
+    return noise_lanes_sub(noise_lanes_mul(value, noise_lanes_set(2.0f / 16777215.0f)), noise_lanes_set(1.0f));
+}
+
+static noise_lanes noise_lanes_fade(noise_lanes t)
+{
+    noise_lanes inner = noise_lanes_sub(noise_lanes_mul(t, noise_lanes_set(6.0f)), noise_lanes_set(15.0f));
+    inner = noise_lanes_add(noise_lanes_mul(t, inner), noise_lanes_set(10.0f));
+    return noise_lanes_mul(noise_lanes_mul(noise_lanes_mul(t, t), t), inner);
+}
+
+static noise_lanes noise_lanes_lerp(noise_lanes a, noise_lanes b, noise_lanes t)
+{
+    return noise_lanes_add(a, noise_lanes_mul(noise_lanes_sub(b, a), t));
+}
+
+/* The gradient tables read back from the hash bits with selects instead of loads. */
+static noise_lanes noise_lanes_gradient2(noise_lanes_u32 hash, noise_lanes x, noise_lanes y)
+{
+    /* entries 0-3: (+-x, +-y); 4-5: (+-x, 0); 6-7: (0, +-y) */
+    noise_lanes u = noise_lanes_select(noise_lanes_bit(noise_lanes_u32_and(hash, noise_lanes_u32_shift_left(hash, 1)), 4), y, x);
+    noise_lanes v = noise_lanes_select(noise_lanes_bit(hash, 4), noise_lanes_set(0.0f), noise_lanes_negate_if(y, hash, 1));
+    return noise_lanes_add(noise_lanes_negate_if(u, hash, 0), v);
+}
+
+static noise_lanes noise_lanes_gradient3(noise_lanes_u32 hash, noise_lanes x, noise_lanes y, noise_lanes z)
+{
+    /* entries 0-3: +-x +-y; 4-7: +-x +-z; 8-11: +-y +-z; 12-13: +-x + y; 14-15: +-z - y */
+    noise_lanes u = noise_lanes_select(noise_lanes_bit(hash, 8),
+                                       noise_lanes_select(noise_lanes_bit(hash, 4), noise_lanes_select(noise_lanes_bit(hash, 2), z, x), y), x);
+    noise_lanes v = noise_lanes_select(noise_lanes_bit(noise_lanes_u32_xor(hash, noise_lanes_u32_shift_right(hash, 1)), 4), z, y);
+    return noise_lanes_add(noise_lanes_negate_if(u, hash, 0), noise_lanes_negate_if(v, hash, 1));
+}
+
+static noise_lanes noise_lanes_gradient4(noise_lanes_u32 hash, noise_lanes x, noise_lanes y, noise_lanes z, noise_lanes w)
+{
+    /* hash bits 3-4 pick the zero axis; bits 2, 1, 0 are the signs of the other three in order */
+    noise_lanes_u32 pair = noise_lanes_u32_shift_left(hash, 1);
+    noise_lanes a = noise_lanes_select(noise_lanes_bit(noise_lanes_u32_or(hash, pair), 16), x, y);
+    noise_lanes b = noise_lanes_select(noise_lanes_bit(hash, 16), y, z);
+    noise_lanes c = noise_lanes_select(noise_lanes_bit(noise_lanes_u32_and(hash, pair), 16), z, w);
+    return noise_lanes_add(noise_lanes_add(noise_lanes_negate_if(a, hash, 2), noise_lanes_negate_if(b, hash, 1)), noise_lanes_negate_if(c, hash, 0));
+}
+
+static noise_lanes noise_lanes_value2(noise_lanes px, noise_lanes py, u32 base)
+{
+    noise_lanes_u32 one = noise_lanes_u32_set(1);
+    noise_lanes_u32 x = noise_lanes_floor(px), y = noise_lanes_floor(py);
+    noise_lanes_u32 x1 = noise_lanes_u32_add(x, one), y1 = noise_lanes_u32_add(y, one);
+    noise_lanes u = noise_lanes_fade(noise_lanes_sub(px, noise_lanes_from_i32(x)));
+    noise_lanes v = noise_lanes_fade(noise_lanes_sub(py, noise_lanes_from_i32(y)));
+    noise_lanes bottom = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash2(base, x, y)), noise_lanes_unit(noise_lanes_hash2(base, x1, y)), u);
+    noise_lanes top = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash2(base, x, y1)), noise_lanes_unit(noise_lanes_hash2(base, x1, y1)), u);
+    return noise_lanes_lerp(bottom, top, v);
+}
+
+static noise_lanes noise_lanes_value3(noise_lanes px, noise_lanes py, noise_lanes pz, u32 base)
+{
+    noise_lanes_u32 one = noise_lanes_u32_set(1);
+    noise_lanes_u32 x = noise_lanes_floor(px), y = noise_lanes_floor(py), z = noise_lanes_floor(pz);
+    noise_lanes_u32 x1 = noise_lanes_u32_add(x, one), y1 = noise_lanes_u32_add(y, one), z1 = noise_lanes_u32_add(z, one);
+    noise_lanes u = noise_lanes_fade(noise_lanes_sub(px, noise_lanes_from_i32(x)));
+    noise_lanes v = noise_lanes_fade(noise_lanes_sub(py, noise_lanes_from_i32(y)));
+    noise_lanes w = noise_lanes_fade(noise_lanes_sub(pz, noise_lanes_from_i32(z)));
+    noise_lanes x00 = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash3(base, x, y, z)), noise_lanes_unit(noise_lanes_hash3(base, x1, y, z)), u);
+    noise_lanes x10 = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash3(base, x, y1, z)), noise_lanes_unit(noise_lanes_hash3(base, x1, y1, z)), u);
+    noise_lanes x01 = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash3(base, x, y, z1)), noise_lanes_unit(noise_lanes_hash3(base, x1, y, z1)), u);
+    noise_lanes x11 = noise_lanes_lerp(noise_lanes_unit(noise_lanes_hash3(base, x, y1, z1)), noise_lanes_unit(noise_lanes_hash3(base, x1, y1, z1)), u);
+    return noise_lanes_lerp(noise_lanes_lerp(x00, x10, v), noise_lanes_lerp(x01, x11, v), w);
+}
+
+static noise_lanes noise_lanes_perlin2(noise_lanes px, noise_lanes py, u32 base)
+{
+    noise_lanes_u32 one = noise_lanes_u32_set(1);
+    noise_lanes_u32 x = noise_lanes_floor(px), y = noise_lanes_floor(py);
+    noise_lanes_u32 x1 = noise_lanes_u32_add(x, one), y1 = noise_lanes_u32_add(y, one);
+    noise_lanes fx = noise_lanes_sub(px, noise_lanes_from_i32(x)), fy = noise_lanes_sub(py, noise_lanes_from_i32(y));
+    noise_lanes fx1 = noise_lanes_sub(fx, noise_lanes_set(1.0f)), fy1 = noise_lanes_sub(fy, noise_lanes_set(1.0f));
+    noise_lanes u = noise_lanes_fade(fx), v = noise_lanes_fade(fy);
+    noise_lanes bottom = noise_lanes_lerp(noise_lanes_gradient2(noise_lanes_hash2(base, x, y), fx, fy),
+                                          noise_lanes_gradient2(noise_lanes_hash2(base, x1, y), fx1, fy), u);
+    noise_lanes top = noise_lanes_lerp(noise_lanes_gradient2(noise_lanes_hash2(base, x, y1), fx, fy1),
+                                       noise_lanes_gradient2(noise_lanes_hash2(base, x1, y1), fx1, fy1), u);
+    return noise_lanes_lerp(bottom, top, v);
+}
+
+static noise_lanes noise_lanes_perlin3(noise_lanes px, noise_lanes py, noise_lanes pz, u32 base)
+{
+    noise_lanes_u32 one = noise_lanes_u32_set(1);
+    noise_lanes_u32 x = noise_lanes_floor(px), y = noise_lanes_floor(py), z = noise_lanes_floor(pz);
+    noise_lanes_u32 x1 = noise_lanes_u32_add(x, one), y1 = noise_lanes_u32_add(y, one), z1 = noise_lanes_u32_add(z, one);
+    noise_lanes fx = noise_lanes_sub(px, noise_lanes_from_i32(x));
+    noise_lanes fy = noise_lanes_sub(py, noise_lanes_from_i32(y));
+    noise_lanes fz = noise_lanes_sub(pz, noise_lanes_from_i32(z));
+    noise_lanes fx1 = noise_lanes_sub(fx, noise_lanes_set(1.0f));
+    noise_lanes fy1 = noise_lanes_sub(fy, noise_lanes_set(1.0f));
+    noise_lanes fz1 = noise_lanes_sub(fz, noise_lanes_set(1.0f));
+    noise_lanes u = noise_lanes_fade(fx), v = noise_lanes_fade(fy), w = noise_lanes_fade(fz);
+    noise_lanes x00 = noise_lanes_lerp(noise_lanes_gradient3(noise_lanes_hash3(base, x, y, z), fx, fy, fz),
+                                       noise_lanes_gradient3(noise_lanes_hash3(base, x1, y, z), fx1, fy, fz), u);
+    noise_lanes x10 = noise_lanes_lerp(noise_lanes_gradient3(noise_lanes_hash3(base, x, y1, z), fx, fy1, fz),
+                                       noise_lanes_gradient3(noise_lanes_hash3(base, x1, y1, z), fx1, fy1, fz), u);
+    noise_lanes x01 = noise_lanes_lerp(noise_lanes_gradient3(noise_lanes_hash3(base, x, y, z1), fx, fy, fz1),
+                                       noise_lanes_gradient3(noise_lanes_hash3(base, x1, y, z1), fx1, fy, fz1), u);
+    noise_lanes x11 = noise_lanes_lerp(noise_lanes_gradient3(noise_lanes_hash3(base, x, y1, z1), fx, fy1, fz1),
+                                       noise_lanes_gradient3(noise_lanes_hash3(base, x1, y1, z1), fx1, fy1, fz1), u);
+    return noise_lanes_lerp(noise_lanes_lerp(x00, x10, v), noise_lanes_lerp(x01, x11, v), w);
+}
+
+static noise_lanes noise_lanes_perlin4(const noise_lanes *point, u32 base)
+{
+    noise_lanes_u32 cell[4];
+    noise_lanes f[4], fade[4], corners[16];
+    u32 corner, axis, width;
+    for (axis = 0; axis < 4; axis++)
+    {
+        cell[axis] = noise_lanes_floor(point[axis]);
+        f[axis] = noise_lanes_sub(point[axis], noise_lanes_from_i32(cell[axis]));
+        fade[axis] = noise_lanes_fade(f[axis]);
+    }
+    for (corner = 0; corner < 16; corner++)
+    {
+        noise_lanes_u32 lattice[4];
+        noise_lanes delta[4];
+        for (axis = 0; axis < 4; axis++)
+        {
+            u32 offset = (corner >> axis) & 1;
+            lattice[axis] = noise_lanes_u32_add(cell[axis], noise_lanes_u32_set(offset));
+            delta[axis] = noise_lanes_sub(f[axis], noise_lanes_set((real)offset));
+        }
+        corners[corner] = noise_lanes_gradient4(noise_lanes_hash4(base, lattice[0], lattice[1], lattice[2], lattice[3]),
+                                                delta[0], delta[1], delta[2], delta[3]);
+    }
+    for (axis = 0, width = 16; axis < 4; axis++, width /= 2)
+    {
+        for (corner = 0; corner < width / 2; corner++)
+        {
+            corners[corner] = noise_lanes_lerp(corners[2 * corner], corners[2 * corner + 1], fade[axis]);
+        }
+    }
+    return corners[0];
+}
+
+/* Simplex corner contribution (falloff^4 * gradient), zero where the falloff is not positive. */
+static noise_lanes noise_lanes_falloff(noise_lanes falloff, noise_lanes gradient)
+{
+    noise_lanes squared = noise_lanes_mul(falloff, falloff);
+    noise_lanes inside = noise_lanes_less(noise_lanes_set(0.0f), falloff);
+    return noise_lanes_and(inside, noise_lanes_mul(noise_lanes_mul(squared, squared), gradient));
+}
+
+static noise_lanes noise_lanes_simplex2(noise_lanes x, noise_lanes y, u32 base)
+{
+    static const real skew = 0.36602540378f;
+    static const real unskew = 0.21132486540f;
+    noise_lanes one = noise_lanes_set(1.0f);
+    noise_lanes s = noise_lanes_mul(noise_lanes_add(x, y), noise_lanes_set(skew));
+    noise_lanes_u32 i = noise_lanes_floor(noise_lanes_add(x, s)), j = noise_lanes_floor(noise_lanes_add(y, s));
+    noise_lanes t = noise_lanes_mul(noise_lanes_from_i32(noise_lanes_u32_add(i, j)), noise_lanes_set(unskew));
+    noise_lanes x0 = noise_lanes_sub(x, noise_lanes_sub(noise_lanes_from_i32(i), t));
+    noise_lanes y0 = noise_lanes_sub(y, noise_lanes_sub(noise_lanes_from_i32(j), t));
+    noise_lanes first = noise_lanes_less(y0, x0);
+    noise_lanes i1 = noise_lanes_and(first, one), j1 = noise_lanes_sub(one, i1);
+    noise_lanes_u32 step = noise_lanes_bits(first);     /* -1 where i1 = 1 */
+    noise_lanes x1 = noise_lanes_add(noise_lanes_sub(x0, i1), noise_lanes_set(unskew));
+    noise_lanes y1 = noise_lanes_add(noise_lanes_sub(y0, j1), noise_lanes_set(unskew));
+    noise_lanes x2 = noise_lanes_add(noise_lanes_sub(x0, one), noise_lanes_set(2.0f * unskew));
+    noise_lanes y2 = noise_lanes_add(noise_lanes_sub(y0, one), noise_lanes_set(2.0f * unskew));
+    noise_lanes_u32 i_one = noise_lanes_u32_add(i, noise_lanes_u32_set(1)), j_one = noise_lanes_u32_add(j, noise_lanes_u32_set(1));
+    noise_lanes half = noise_lanes_set(0.5f);
+    noise_lanes sum = noise_lanes_set(0.0f);
+
+    sum = noise_lanes_add(sum, noise_lanes_falloff(noise_lanes_sub(noise_lanes_sub(half, noise_lanes_mul(x0, x0)), noise_lanes_mul(y0, y0)),
+                                                   noise_lanes_gradient2(noise_lanes_hash2(base, i, j), x0, y0)));
+    sum = noise_lanes_add(sum, noise_lanes_falloff(noise_lanes_sub(noise_lanes_sub(half, noise_lanes_mul(x1, x1)), noise_lanes_mul(y1, y1)),
+                                                   noise_lanes_gradient2(noise_lanes_hash2(base, noise_lanes_u32_sub(i, step), noise_lanes_u32_add(j_one, step)), x1, y1)));
+    sum = noise_lanes_add(sum, noise_lanes_falloff(noise_lanes_sub(noise_lanes_sub(half, noise_lanes_mul(x2, x2)), noise_lanes_mul(y2, y2)),
+                                                   noise_lanes_gradient2(noise_lanes_hash2(base, i_one, j_one), x2, y2)));
+    return noise_lanes_mul(noise_lanes_set(70.0f), sum);
+}
+
+static noise_lanes noise_lanes_simplex3(noise_lanes x, noise_lanes y, noise_lanes z, u32 base)
+{
+    static const real skew = 1.0f / 3.0f;
+    static const real unskew = 1.0f / 6.0f;
+    noise_lanes one = noise_lanes_set(1.0f);
+    noise_lanes all = noise_lanes_cast(noise_lanes_u32_set(0xffffffffu));
+    noise_lanes s = noise_lanes_mul(noise_lanes_add(noise_lanes_add(x, y), z), noise_lanes_set(skew));
+    noise_lanes_u32 cell[3];
+    noise_lanes origin[3], steps[4][3];
+    noise_lanes t, sum = noise_lanes_set(0.0f);
+    u32 corner, axis;
+
+    cell[0] = noise_lanes_floor(noise_lanes_add(x, s));
+    cell[1] = noise_lanes_floor(noise_lanes_add(y, s));
+    cell[2] = noise_lanes_floor(noise_lanes_add(z, s));
+    t = noise_lanes_mul(noise_lanes_from_i32(noise_lanes_u32_add(noise_lanes_u32_add(cell[0], cell[1]), cell[2])), noise_lanes_set(unskew));
+    origin[0] = noise_lanes_sub(x, noise_lanes_sub(noise_lanes_from_i32(cell[0]), t));
+    origin[1] = noise_lanes_sub(y, noise_lanes_sub(noise_lanes_from_i32(cell[1]), t));
+    origin[2] = noise_lanes_sub(z, noise_lanes_sub(noise_lanes_from_i32(cell[2]), t));
+
+    /* Step masks, as in noise_simplex3. */
+    {
+        noise_lanes x_ge_y = noise_lanes_less_equal(origin[1], origin[0]), x_ge_z = noise_lanes_less_equal(origin[2], origin[0]);
+        noise_lanes y_ge_z = noise_lanes_less_equal(origin[2], origin[1]);
+        noise_lanes y_gt_x = noise_lanes_less(origin[0], origin[1]), z_gt_x = noise_lanes_less(origin[0], origin[2]);
+        noise_lanes z_gt_y = noise_lanes_less(origin[1], origin[2]);
+        steps[0][0] = steps[0][1] = steps[0][2] = noise_lanes_set(0.0f);
+        steps[3][0] = steps[3][1] = steps[3][2] = all;
+        steps[1][0] = noise_lanes_and(x_ge_y, x_ge_z);
+        steps[1][1] = noise_lanes_and(noise_lanes_xor(steps[1][0], all), y_ge_z);
+        steps[1][2] = noise_lanes_xor(noise_lanes_or(steps[1][0], steps[1][1]), all);
+        steps[2][0] = noise_lanes_or(x_ge_y, x_ge_z);
+        steps[2][1] = noise_lanes_or(y_gt_x, y_ge_z);
+        steps[2][2] = noise_lanes_or(z_gt_x, z_gt_y);
+    }
+    for (corner = 0; corner < 4; corner++)
+    {
+        noise_lanes offset = noise_lanes_set((real)corner * unskew);
+        noise_lanes_u32 lattice[3];
+        noise_lanes delta[3];
+        noise_lanes falloff = noise_lanes_set(0.6f);
+        for (axis = 0; axis < 3; axis++)
+        {
+            lattice[axis] = noise_lanes_u32_sub(cell[axis], noise_lanes_bits(steps[corner][axis]));
+            delta[axis] = noise_lanes_add(noise_lanes_sub(origin[axis], noise_lanes_and(steps[corner][axis], one)), offset);
+            falloff = noise_lanes_sub(falloff, noise_lanes_mul(delta[axis], delta[axis]));
+        }
+        sum = noise_lanes_add(sum, noise_lanes_falloff(falloff, noise_lanes_gradient3(noise_lanes_hash3(base, lattice[0], lattice[1], lattice[2]),
+                                                                                      delta[0], delta[1], delta[2])));
+    }
+    return noise_lanes_mul(noise_lanes_set(32.0f), sum);
+}
+
+static noise_lanes noise_lanes_simplex4(const noise_lanes *point, u32 base)
+{
+    static const real skew = 0.30901699437f;
+    static const real unskew = 0.13819660113f;
+    noise_lanes one = noise_lanes_set(1.0f);
+    noise_lanes s = noise_lanes_mul(noise_lanes_add(noise_lanes_add(noise_lanes_add(point[0], point[1]), point[2]), point[3]), noise_lanes_set(skew));
+    noise_lanes t = noise_lanes_set(0.0f), sum = noise_lanes_set(0.0f);
+    noise_lanes_u32 cell[4], rank[4];
+    noise_lanes origin[4];
+    u32 axis, other, corner;
+
+    for (axis = 0; axis < 4; axis++)
+    {
+        cell[axis] = noise_lanes_floor(noise_lanes_add(point[axis], s));
+        t = noise_lanes_add(t, noise_lanes_from_i32(cell[axis]));
+        rank[axis] = noise_lanes_u32_set(0);
+    }
+    t = noise_lanes_mul(t, noise_lanes_set(unskew));
+    for (axis = 0; axis < 4; axis++)
+    {
+        origin[axis] = noise_lanes_sub(point[axis], noise_lanes_sub(noise_lanes_from_i32(cell[axis]), t));
+    }
+    for (axis = 0; axis < 4; axis++)
+    {
+        for (other = axis + 1; other < 4; other++)
+        {
+            /* -1 where origin[axis] > origin[other]: that lane ranks `axis` up, the others rank `other` up */
+            noise_lanes_u32 greater = noise_lanes_bits(noise_lanes_less(origin[other], origin[axis]));
+            rank[axis] = noise_lanes_u32_sub(rank[axis], greater);
+            rank[other] = noise_lanes_u32_add(rank[other], noise_lanes_u32_add(greater, noise_lanes_u32_set(1)));
+        }
+    }
+    for (corner = 0; corner < 5; corner++)
+    {
+        noise_lanes offset = noise_lanes_set((real)corner * unskew);
+        noise_lanes_u32 threshold = noise_lanes_u32_set((u32)3 - corner);
+        noise_lanes_u32 lattice[4];
+        noise_lanes delta[4];
+        noise_lanes falloff = noise_lanes_set(0.6f);
+        for (axis = 0; axis < 4; axis++)
+        {
+            noise_lanes_u32 step = noise_lanes_i32_greater(rank[axis], threshold);
+            lattice[axis] = noise_lanes_u32_sub(cell[axis], step);
+            delta[axis] = noise_lanes_add(noise_lanes_sub(origin[axis], noise_lanes_and(noise_lanes_cast(step), one)), offset);
+            falloff = noise_lanes_sub(falloff, noise_lanes_mul(delta[axis], delta[axis]));
+        }
+        sum = noise_lanes_add(sum, noise_lanes_falloff(falloff, noise_lanes_gradient4(noise_lanes_hash4(base, lattice[0], lattice[1], lattice[2], lattice[3]),
+                                                                                      delta[0], delta[1], delta[2], delta[3])));
+    }
+    return noise_lanes_mul(noise_lanes_set(27.0f), sum);
+}
+
+/* Fold one squared feature distance into the (F1, F2) pair, as in noise_worley*. */
+static void noise_lanes_worley_insert(noise_lanes distance_squared, noise_lanes *nearest, noise_lanes *second)
+{
+    noise_lanes closer = noise_lanes_less(distance_squared, *nearest);
+    *second = noise_lanes_select(closer, *nearest, noise_lanes_select(noise_lanes_less(distance_squared, *second), distance_squared, *second));
+    *nearest = noise_lanes_select(closer, distance_squared, *nearest);
+}
+
+static void noise_lanes_worley2(noise_lanes px, noise_lanes py, u32 base, noise_lanes *f1, noise_lanes *f2)
+{
+    noise_lanes_u32 cell_x = noise_lanes_floor(px), cell_y = noise_lanes_floor(py);
+    noise_lanes nearest = noise_lanes_set(1e30f), second = noise_lanes_set(1e30f);
+    i32 dx, dy;
+    for (dy = -1; dy <= 1; dy++)
+    for (dx = -1; dx <= 1; dx++)
+    {
+        noise_lanes_u32 x = noise_lanes_u32_add(cell_x, noise_lanes_u32_set((u32)dx));
+        noise_lanes_u32 y = noise_lanes_u32_add(cell_y, noise_lanes_u32_set((u32)dy));
+        noise_lanes_u32 hash = noise_lanes_hash2(base, x, y);
+        noise_lanes jitter_x = noise_lanes_from_i32(noise_lanes_u32_and(hash, noise_lanes_u32_set(0xffff)));
+        noise_lanes jitter_y = noise_lanes_from_i32(noise_lanes_u32_shift_right(hash, 16));
+        noise_lanes ox = noise_lanes_sub(noise_lanes_add(noise_lanes_from_i32(x), noise_lanes_mul(jitter_x, noise_lanes_set(1.0f / 65536.0f))), px);
+        noise_lanes oy = noise_lanes_sub(noise_lanes_add(noise_lanes_from_i32(y), noise_lanes_mul(jitter_y, noise_lanes_set(1.0f / 65536.0f))), py);
+        noise_lanes_worley_insert(noise_lanes_add(noise_lanes_mul(ox, ox), noise_lanes_mul(oy, oy)), &nearest, &second);
+    }
+    *f1 = noise_lanes_sqrt(nearest);
+    *f2 = noise_lanes_sqrt(second);
+}
+
+static void noise_lanes_worley3(noise_lanes px, noise_lanes py, noise_lanes pz, u32 base, noise_lanes *f1, noise_lanes *f2)
+{
+    noise_lanes_u32 cell_x = noise_lanes_floor(px), cell_y = noise_lanes_floor(py), cell_z = noise_lanes_floor(pz);
+    noise_lanes_u32 low = noise_lanes_u32_set(0x7ff);
+    noise_lanes nearest = noise_lanes_set(1e30f), second = noise_lanes_set(1e30f);
+    i32 dx, dy, dz;
+    for (dz = -1; dz <= 1; dz++)
+    for (dy = -1; dy <= 1; dy++)
+    for (dx = -1; dx <= 1; dx++)
+    {
+        noise_lanes_u32 x = noise_lanes_u32_add(cell_x, noise_lanes_u32_set((u32)dx));
+        noise_lanes_u32 y = noise_lanes_u32_add(cell_y, noise_lanes_u32_set((u32)dy));
+        noise_lanes_u32 z = noise_lanes_u32_add(cell_z, noise_lanes_u32_set((u32)dz));
+        noise_lanes_u32 hash = noise_lanes_hash3(base, x, y, z);
+        noise_lanes jitter_x = noise_lanes_from_i32(noise_lanes_u32_and(hash, low));
+        noise_lanes jitter_y = noise_lanes_from_i32(noise_lanes_u32_and(noise_lanes_u32_shift_right(hash, 11), low));
+        noise_lanes jitter_z = noise_lanes_from_i32(noise_lanes_u32_shift_right(hash, 22));
+        noise_lanes ox = noise_lanes_sub(noise_lanes_add(noise_lanes_from_i32(x), noise_lanes_mul(jitter_x, noise_lanes_set(1.0f / 2048.0f))), px);
+        noise_lanes oy = noise_lanes_sub(noise_lanes_add(noise_lanes_from_i32(y), noise_lanes_mul(jitter_y, noise_lanes_set(1.0f / 2048.0f))), py);
+        noise_lanes oz = noise_lanes_sub(noise_lanes_add(noise_lanes_from_i32(z), noise_lanes_mul(jitter_z, noise_lanes_set(1.0f / 1024.0f))), pz);
+        noise_lanes_worley_insert(noise_lanes_add(noise_lanes_add(noise_lanes_mul(ox, ox), noise_lanes_mul(oy, oy)), noise_lanes_mul(oz, oz)),
+                                  &nearest, &second);
+    }
+    *f1 = noise_lanes_sqrt(nearest);
+    *f2 = noise_lanes_sqrt(second);
+}
+
+/* fBm over lanes; `point` holds `dimensions` (2 or 3) components and is scaled in place per octave. */
+static noise_lanes noise_lanes_fbm(noise_lanes *point, u32 dimensions, u32 octaves, real lacunarity, real gain, u32 seed)
+{
+    noise_lanes sum = noise_lanes_set(0.0f);
+    real amplitude = 1.0f, total = 0.0f;
+    u32 octave, axis;
+    for (octave = 0; octave < octaves; octave++)
+    {
+        u32 base = noise_seed(seed + octave);
+        noise_lanes sample = dimensions == 2 ? noise_lanes_simplex2(point[0], point[1], base)
+                                             : noise_lanes_simplex3(point[0], point[1], point[2], base);
+        sum = noise_lanes_add(sum, noise_lanes_mul(noise_lanes_set(amplitude), sample));
+        total += amplitude;
+        amplitude *= gain;
+        for (axis = 0; axis < dimensions; axis++)
+        {
+            point[axis] = noise_lanes_mul(point[axis], noise_lanes_set(lacunarity));
+        }
+    }
+    return total > 0.0f ? noise_lanes_div(sum, noise_lanes_set(total)) : noise_lanes_set(0.0f);
+}
+
+#endif /* VECTORS_NOISE_LANES */
+
+/* ---- batched evaluation ---- */
+
+/* The *_array forms run VECTORS_NOISE_LANES points at a time when SSE2 or AVX2 is available and finish
+   the remainder with the scalar function. Both give the same values unless the compiler contracts the
+   scalar code into FMAs (-ffp-contract). */
+
+/* Value noise of `count` points. */
+static void noise_value2_array(const vec2 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec2) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_value2(noise_lanes_gather(points[i].components, stride),
+                                                      noise_lanes_gather(points[i].components + 1, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_value2(points[i], seed);
+    }
+}
+
+/* Value noise of `count` points. */
+static void noise_value3_array(const vec3 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec3) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_value3(noise_lanes_gather(points[i].components, stride),
+                                                      noise_lanes_gather(points[i].components + 1, stride),
+                                                      noise_lanes_gather(points[i].components + 2, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_value3(points[i], seed);
+    }
+}
+
+/* Perlin noise of `count` points. */
+static void noise_perlin2_array(const vec2 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec2) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_perlin2(noise_lanes_gather(points[i].components, stride),
+                                                       noise_lanes_gather(points[i].components + 1, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_perlin2(points[i], seed);
+    }
+}
+
+/* Perlin noise of `count` points. */
+static void noise_perlin3_array(const vec3 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec3) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_perlin3(noise_lanes_gather(points[i].components, stride),
+                                                       noise_lanes_gather(points[i].components + 1, stride),
+                                                       noise_lanes_gather(points[i].components + 2, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_perlin3(points[i], seed);
+    }
+}
+
+/* Perlin noise of `count` points. */
+static void noise_perlin4_array(const vec4 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec4) / sizeof(real));
+    u32 base = noise_seed(seed);
+    noise_lanes point[4];
+    u32 axis;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        for (axis = 0; axis < 4; axis++)
+        {
+            point[axis] = noise_lanes_gather(points[i].components + axis, stride);
+        }
+        noise_lanes_store(dst + i, noise_lanes_perlin4(point, base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_perlin4(points[i], seed);
+    }
+}
+
+/* Simplex noise of `count` points. */
+static void noise_simplex2_array(const vec2 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec2) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_simplex2(noise_lanes_gather(points[i].components, stride),
+                                                        noise_lanes_gather(points[i].components + 1, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_simplex2(points[i], seed);
+    }
+}
+
+/* Simplex noise of `count` points. */
+static void noise_simplex3_array(const vec3 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec3) / sizeof(real));
+    u32 base = noise_seed(seed);
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes_store(dst + i, noise_lanes_simplex3(noise_lanes_gather(points[i].components, stride),
+                                                        noise_lanes_gather(points[i].components + 1, stride),
+                                                        noise_lanes_gather(points[i].components + 2, stride), base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_simplex3(points[i], seed);
+    }
+}
+
+/* Simplex noise of `count` points. */
+static void noise_simplex4_array(const vec4 *points, u32 count, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec4) / sizeof(real));
+    u32 base = noise_seed(seed);
+    noise_lanes point[4];
+    u32 axis;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        for (axis = 0; axis < 4; axis++)
+        {
+            point[axis] = noise_lanes_gather(points[i].components + axis, stride);
+        }
+        noise_lanes_store(dst + i, noise_lanes_simplex4(point, base));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_simplex4(points[i], seed);
+    }
+}
+
+/* Worley (F1, F2) of `count` points. */
+static void noise_worley2_array(const vec2 *points, u32 count, u32 seed, vec2 *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec2) / sizeof(real));
+    u32 base = noise_seed(seed);
+    real nearest[VECTORS_NOISE_LANES], second[VECTORS_NOISE_LANES];
+    u32 n;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes f1, f2;
+        noise_lanes_worley2(noise_lanes_gather(points[i].components, stride),
+                            noise_lanes_gather(points[i].components + 1, stride), base, &f1, &f2);
+        noise_lanes_store(nearest, f1);
+        noise_lanes_store(second, f2);
+        for (n = 0; n < VECTORS_NOISE_LANES; n++)
+        {
+            dst[i + n] = vec2_init_from_2(nearest[n], second[n]);
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_worley2(points[i], seed);
+    }
+}
+
+/* Worley (F1, F2) of `count` points. */
+static void noise_worley3_array(const vec3 *points, u32 count, u32 seed, vec2 *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec3) / sizeof(real));
+    u32 base = noise_seed(seed);
+    real nearest[VECTORS_NOISE_LANES], second[VECTORS_NOISE_LANES];
+    u32 n;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        noise_lanes f1, f2;
+        noise_lanes_worley3(noise_lanes_gather(points[i].components, stride),
+                            noise_lanes_gather(points[i].components + 1, stride),
+                            noise_lanes_gather(points[i].components + 2, stride), base, &f1, &f2);
+        noise_lanes_store(nearest, f1);
+        noise_lanes_store(second, f2);
+        for (n = 0; n < VECTORS_NOISE_LANES; n++)
+        {
+            dst[i + n] = vec2_init_from_2(nearest[n], second[n]);
+        }
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_worley3(points[i], seed);
+    }
+}
+
+/* fBm of `count` points. */
+static void noise_fbm2_array(const vec2 *points, u32 count, u32 octaves, real lacunarity, real gain, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec2) / sizeof(real));
+    noise_lanes point[3];
+    u32 axis;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        for (axis = 0; axis < 2; axis++)
+        {
+            point[axis] = noise_lanes_gather(points[i].components + axis, stride);
+        }
+        noise_lanes_store(dst + i, noise_lanes_fbm(point, 2, octaves, lacunarity, gain, seed));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_fbm2(points[i], octaves, lacunarity, gain, seed);
+    }
+}
+
+/* fBm of `count` points. */
+static void noise_fbm3_array(const vec3 *points, u32 count, u32 octaves, real lacunarity, real gain, u32 seed, real *dst)
+{
+    u32 i = 0;
+#if defined(VECTORS_NOISE_LANES)
+    u32 stride = (u32)(sizeof(vec3) / sizeof(real));
+    noise_lanes point[3];
+    u32 axis;
+    for (; i + VECTORS_NOISE_LANES <= count; i += VECTORS_NOISE_LANES)
+    {
+        for (axis = 0; axis < 3; axis++)
+        {
+            point[axis] = noise_lanes_gather(points[i].components + axis, stride);
+        }
+        noise_lanes_store(dst + i, noise_lanes_fbm(point, 3, octaves, lacunarity, gain, seed));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = noise_fbm3(points[i], octaves, lacunarity, gain, seed);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_NOISE_H */
@@ -0,0 +1,521 @@
+#if !defined(VECTORS_PARALLEL_H)
+#define VECTORS_PARALLEL_H
+
+#include <stdlib.h>
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_PARALLEL_NO_THREADS     every call runs on the calling thread.
+    VECTORS_PARALLEL_CHUNK_BYTES    bytes of output per scheduled chunk.
+    VECTORS_PARALLEL_THRESHOLD      element count below which calls stay serial.
+    Threads use Win32 on _WIN32 and pthreads elsewhere (link with -pthread).
+   ------------------------------------------------------------------------- */
+#if !defined(VECTORS_PARALLEL_CHUNK_BYTES)
+    #define VECTORS_PARALLEL_CHUNK_BYTES 32768
+#endif
+#if !defined(VECTORS_PARALLEL_THRESHOLD)
+    #define VECTORS_PARALLEL_THRESHOLD 16384
+#endif
+
+#if defined(VECTORS_PARALLEL_NO_THREADS)
+    /* nothing to include */
+#elif defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Threading primitives - mutex, condition variable and thread per backend
+   ------------------------------------------------------------------------- */
+#if defined(VECTORS_PARALLEL_NO_THREADS)
+    typedef int parallel_mutex;
+    typedef int parallel_cond;
+    typedef int parallel_thread;
+
+    static void parallel_mutex_init(parallel_mutex *mutex)      { *mutex = 0; }
+    static void parallel_mutex_destroy(parallel_mutex *mutex)   { (void)mutex; }
+    static void parallel_mutex_lock(parallel_mutex *mutex)      { (void)mutex; }
+    static void parallel_mutex_unlock(parallel_mutex *mutex)    { (void)mutex; }
+    static void parallel_cond_init(parallel_cond *cond)         { *cond = 0; }
+    static void parallel_cond_destroy(parallel_cond *cond)      { (void)cond; }
+    static void parallel_cond_wait(parallel_cond *cond, parallel_mutex *mutex) { (void)cond; (void)mutex; }
+    static void parallel_cond_broadcast(parallel_cond *cond)    { (void)cond; }
+#elif defined(_WIN32)
+    typedef CRITICAL_SECTION parallel_mutex;
+    typedef CONDITION_VARIABLE parallel_cond;
+    typedef HANDLE parallel_thread;
+
+    static void parallel_mutex_init(parallel_mutex *mutex)      { InitializeCriticalSection(mutex); }
+    static void parallel_mutex_destroy(parallel_mutex *mutex)   { DeleteCriticalSection(mutex); }
+    static void parallel_mutex_lock(parallel_mutex *mutex)      { EnterCriticalSection(mutex); }
+    static void parallel_mutex_unlock(parallel_mutex *mutex)    { LeaveCriticalSection(mutex); }
+    static void parallel_cond_init(parallel_cond *cond)         { InitializeConditionVariable(cond); }
+    static void parallel_cond_destroy(parallel_cond *cond)      { (void)cond; }
+    static void parallel_cond_wait(parallel_cond *cond, parallel_mutex *mutex) { SleepConditionVariableCS(cond, mutex, INFINITE); }
+    static void parallel_cond_broadcast(parallel_cond *cond)    { WakeAllConditionVariable(cond); }
+#else
+    typedef pthread_mutex_t parallel_mutex;
+    typedef pthread_cond_t parallel_cond;
+    typedef pthread_t parallel_thread;
+
+    static void parallel_mutex_init(parallel_mutex *mutex)      { pthread_mutex_init(mutex, NULL); }
+    static void parallel_mutex_destroy(parallel_mutex *mutex)   { pthread_mutex_destroy(mutex); }
+    static void parallel_mutex_lock(parallel_mutex *mutex)      { pthread_mutex_lock(mutex); }
+    static void parallel_mutex_unlock(parallel_mutex *mutex)    { pthread_mutex_unlock(mutex); }
+    static void parallel_cond_init(parallel_cond *cond)         { pthread_cond_init(cond, NULL); }
+    static void parallel_cond_destroy(parallel_cond *cond)      { pthread_cond_destroy(cond); }
+    static void parallel_cond_wait(parallel_cond *cond, parallel_mutex *mutex) { pthread_cond_wait(cond, mutex); }
+    static void parallel_cond_broadcast(parallel_cond *cond)    { pthread_cond_broadcast(cond); }
+#endif
+
+/* -------------------------------------------------------------------------
+   Thread pool - each worker owns a contiguous run of chunks, pops from its
+   front and, once empty, steals single chunks from the back of the others.
+   The calling thread is worker 0, so a pool of N workers starts N-1 threads.
+   ------------------------------------------------------------------------- */
+
+/* A range of the array [begin, end) processed by `worker` (0..worker_count-1). */
+typedef void (*parallel_task)(void *user, u32 begin, u32 end, u32 worker);
+
+/* Per-worker run of chunk indices [next, end). */
+typedef struct parallel_queue
+{
+    parallel_mutex lock;
+    u32 next;
+    u32 end;
+} parallel_queue;
+
+typedef struct parallel_pool parallel_pool;
+
+typedef struct parallel_worker
+{
+    parallel_pool *pool;
+    u32 index;
+    parallel_thread thread;
+} parallel_worker;
+
+struct parallel_pool
+{
+    u32 worker_count;
+    u32 threshold;
+    bool deterministic;
+
+    parallel_queue *queues;
+    parallel_worker *workers;
+
+    /* current job */
+    parallel_task task;
+    void *user;
+    u32 count;
+    u32 grain;
+
+    parallel_mutex lock;
+    parallel_cond wake;
+    parallel_cond done;
+    u32 generation;
+    u32 pending;
+    bool quit;
+};
+
+/* Pop the next chunk from the front of a worker's own queue. */
+static bool parallel_queue_pop(parallel_queue *queue, u32 *chunk)
+{
+    bool popped;
+    parallel_mutex_lock(&queue->lock);
+    popped = BOOL(queue->next < queue->end);
+    if (popped)
+    {
+        *chunk = queue->next++;
+    }
+    parallel_mutex_unlock(&queue->lock);
+    return popped;
+}
+
+/* Steal one chunk from the back of another worker's queue. */
+static bool parallel_queue_steal(parallel_queue *queue, u32 *chunk)
+{
+    bool stolen;
+    parallel_mutex_lock(&queue->lock);
+    stolen = BOOL(queue->next < queue->end);
+    if (stolen)
+    {
+        *chunk = --queue->end;
+    }
+    parallel_mutex_unlock(&queue->lock);
+    return stolen;
+}
+
+/* Run one chunk of the current job. */
+static void parallel_run_chunk(parallel_pool *pool, u32 chunk, u32 worker)
+{
+    u32 begin = chunk * pool->grain;
+    u32 end = pool->count - begin < pool->grain ? pool->count : begin + pool->grain;
+    pool->task(pool->user, begin, end, worker);
+}
+
+/* Drain this worker's own chunks, then (unless deterministic) steal from the others. */
+static void parallel_run_worker(parallel_pool *pool, u32 worker)
+{
+    u32 chunk;
+    u32 offset;
+    while (parallel_queue_pop(&pool->queues[worker], &chunk))
+    {
+        parallel_run_chunk(pool, chunk, worker);
+    }
+    if (pool->deterministic)
+    {
+        return;
+    }
+    for (offset = 1; offset < pool->worker_count; offset++)
+    {
+        parallel_queue *victim = &pool->queues[(worker + offset) % pool->worker_count];
+        while (parallel_queue_steal(victim, &chunk))
+        {
+            parallel_run_chunk(pool, chunk, worker);
+        }
+    }
+}
+
+/* Worker thread loop: sleep until a new job generation is published, help run it, report back. */
+static void parallel_worker_loop(parallel_worker *worker)
+{
+    parallel_pool *pool = worker->pool;
+    u32 seen = 0;
+    for (;;)
+    {
+        parallel_mutex_lock(&pool->lock);
+        while (pool->generation == seen && !pool->quit)
+        {
+            parallel_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->quit)
+        {
+            parallel_mutex_unlock(&pool->lock);
+            return;
+        }
+        seen = pool->generation;
+        parallel_mutex_unlock(&pool->lock);
+
+        parallel_run_worker(pool, worker->index);
+
+        parallel_mutex_lock(&pool->lock);
+        if (--pool->pending == 0)
+        {
+            parallel_cond_broadcast(&pool->done);
+        }
+        parallel_mutex_unlock(&pool->lock);
+    }
+}
+
+#if defined(VECTORS_PARALLEL_NO_THREADS)
+    static bool parallel_thread_start(parallel_worker *worker) { (void)worker; return BOOL(0); }
+    static void parallel_thread_join(parallel_worker *worker)  { (void)worker; }
+#elif defined(_WIN32)
+    static DWORD WINAPI parallel_thread_main(LPVOID arg) { parallel_worker_loop((parallel_worker *)arg); return 0; }
+    static bool parallel_thread_start(parallel_worker *worker)
+    {
+        worker->thread = CreateThread(NULL, 0, parallel_thread_main, worker, 0, NULL);
+        return BOOL(worker->thread != NULL);
+    }
+    static void parallel_thread_join(parallel_worker *worker)
+    {
+        WaitForSingleObject(worker->thread, INFINITE);
+        CloseHandle(worker->thread);
+    }
+#else
+    static void *parallel_thread_main(void *arg) { parallel_worker_loop((parallel_worker *)arg); return NULL; }
+    static bool parallel_thread_start(parallel_worker *worker)
+    {
+        return BOOL(pthread_create(&worker->thread, NULL, parallel_thread_main, worker) == 0);
+    }
+    static void parallel_thread_join(parallel_worker *worker)
+    {
+        pthread_join(worker->thread, NULL);
+    }
+#endif
+
+/* Stop and free a pool created by parallel_pool_create (NULL is ignored). */
+static void parallel_pool_destroy(parallel_pool *pool)
+{
+    u32 i;
+    if (pool == NULL)
+    {
+        return;
+    }
+    parallel_mutex_lock(&pool->lock);
+    pool->quit = BOOL(1);
+    parallel_cond_broadcast(&pool->wake);
+    parallel_mutex_unlock(&pool->lock);
+    for (i = 1; i < pool->worker_count; i++)
+    {
+        parallel_thread_join(&pool->workers[i]);
+    }
+    for (i = 0; i < pool->worker_count; i++)
+    {
+        parallel_mutex_destroy(&pool->queues[i].lock);
+    }
+    parallel_cond_destroy(&pool->done);
+    parallel_cond_destroy(&pool->wake);
+    parallel_mutex_destroy(&pool->lock);
+    free(pool->queues);
+    free(pool->workers);
+    free(pool);
+}
+
+/* Create a pool of `worker_count` workers including the calling thread (0 or 1 = serial).
+   Returns NULL if allocation fails; fewer workers are used if threads fail to start. */
+static parallel_pool *parallel_pool_create(u32 worker_count)
+{
+    parallel_pool *pool;
+    u32 i;
+#if defined(VECTORS_PARALLEL_NO_THREADS)
+    worker_count = 1;
+#endif
+    if (worker_count == 0)
+    {
+        worker_count = 1;
+    }
+    pool = (parallel_pool *)calloc(1, sizeof(parallel_pool));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    pool->queues = (parallel_queue *)calloc(worker_count, sizeof(parallel_queue));
+    pool->workers = (parallel_worker *)calloc(worker_count, sizeof(parallel_worker));
+    if (pool->queues == NULL || pool->workers == NULL)
+    {
+        free(pool->queues);
+        free(pool->workers);
+        free(pool);
+        return NULL;
+    }
+    pool->threshold = VECTORS_PARALLEL_THRESHOLD;
+    pool->deterministic = BOOL(0);
+    parallel_mutex_init(&pool->lock);
+    parallel_cond_init(&pool->wake);
+    parallel_cond_init(&pool->done);
+    for (i = 0; i < worker_count; i++)
+    {
+        parallel_mutex_init(&pool->queues[i].lock);
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+    }
+
+    /* Worker 0 is the calling thread; worker_count only counts threads that actually started. */
+    pool->worker_count = 1;
+    for (i = 1; i < worker_count; i++)
+    {
+        if (!parallel_thread_start(&pool->workers[i]))
+        {
+            break;
+        }
+        pool->worker_count++;
+    }
+    /* parallel_pool_destroy only sees started workers, so release the queues of the rest now. */
+    for (i = pool->worker_count; i < worker_count; i++)
+    {
+        parallel_mutex_destroy(&pool->queues[i].lock);
+    }
+    return pool;
+}
+
+/* Deterministic mode disables stealing: chunk c always runs on the same worker, in the same order. */
+static void parallel_pool_set_deterministic(parallel_pool *pool, bool deterministic)
+{
+    pool->deterministic = BOOL(deterministic);
+}
+
+/* Element count below which parallel_for runs the whole range on the calling thread. */
+static void parallel_pool_set_threshold(parallel_pool *pool, u32 threshold)
+{
+    pool->threshold = threshold;
+}
+
+/* Split [0, count) into chunks of `grain` elements and run them on the pool, returning when all are done.
+   Runs serially (as a single task call on worker 0) for a NULL or 1-worker pool, or below the threshold.
+   One job at a time per pool: do not call it concurrently or from inside a task. */
+static void parallel_for(parallel_pool *pool, u32 count, u32 grain, parallel_task task, void *user)
+{
+    u32 chunk_count;
+    u32 i;
+    if (grain == 0)
+    {
+        grain = 1;
+    }
+    chunk_count = count / grain + (count % grain != 0);
+    if (pool == NULL || pool->worker_count <= 1 || count < pool->threshold || chunk_count < 2)
+    {
+        if (count > 0)
+        {
+            task(user, 0, count, 0);
+        }
+        return;
+    }
+
+    /* Hand each worker an equal contiguous run of chunks. */
+    for (i = 0; i < pool->worker_count; i++)
+    {
+        pool->queues[i].next = (u32)(((u64)chunk_count * i) / pool->worker_count);
+        pool->queues[i].end = (u32)(((u64)chunk_count * (i + 1)) / pool->worker_count);
+    }
+
+    parallel_mutex_lock(&pool->lock);
+    pool->task = task;
+    pool->user = user;
+    pool->count = count;
+    pool->grain = grain;
+    pool->pending = pool->worker_count - 1;
+    pool->generation++;
+    parallel_cond_broadcast(&pool->wake);
+    parallel_mutex_unlock(&pool->lock);
+
+    parallel_run_worker(pool, 0);
+
+    parallel_mutex_lock(&pool->lock);
+    while (pool->pending != 0)
+    {
+        parallel_cond_wait(&pool->done, &pool->lock);
+    }
+    parallel_mutex_unlock(&pool->lock);
+}
+
+/* Elements per chunk so that one chunk writes about VECTORS_PARALLEL_CHUNK_BYTES. */
+static u32 parallel_grain(u32 element_size)
+{
+    u32 grain = VECTORS_PARALLEL_CHUNK_BYTES / element_size;
+    return grain > 0 ? grain : 1;
+}
+
+/* -------------------------------------------------------------------------
+   Parallel array kernels - chunked wrappers over the bulk transforms
+   ------------------------------------------------------------------------- */
+
+typedef struct parallel_transform_args
+{
+    mat4 matrix;
+    const void *src;
+    void *dst;
+} parallel_transform_args;
+
+static void parallel_mat4_mul_vec4_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    parallel_transform_args *args = (parallel_transform_args *)user;
+    (void)worker;
+    mat4_mul_vec4_array(args->matrix, (const vec4 *)args->src + begin, (vec4 *)args->dst + begin, end - begin);
+}
+
+/* Parallel mat4_mul_vec4_array (dst may alias src). */
+static void mat4_mul_vec4_array_parallel(parallel_pool *pool, mat4 m, const vec4 *src, vec4 *dst, u32 count)
+{
+    parallel_transform_args args;
+    args.matrix = m;
+    args.src = src;
+    args.dst = dst;
+    parallel_for(pool, count, parallel_grain(sizeof(vec4)), parallel_mat4_mul_vec4_task, &args);
+}
+
+static void parallel_mat4_transform_vec3_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    parallel_transform_args *args = (parallel_transform_args *)user;
+    (void)worker;
+    mat4_transform_vec3_array(args->matrix, (const vec3 *)args->src + begin, (vec3 *)args->dst + begin, end - begin);
+}
+
+/* Parallel mat4_transform_vec3_array (dst may alias src). */
+static void mat4_transform_vec3_array_parallel(parallel_pool *pool, mat4 m, const vec3 *src, vec3 *dst, u32 count)
+{
+    parallel_transform_args args;
+    args.matrix = m;
+    args.src = src;
+    args.dst = dst;
+    parallel_for(pool, count, parallel_grain(sizeof(vec3)), parallel_mat4_transform_vec3_task, &args);
+}
+
+static void parallel_vec3_normalize_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    parallel_transform_args *args = (parallel_transform_args *)user;
+    (void)worker;
+    vec3_normalize_array((const vec3 *)args->src + begin, (vec3 *)args->dst + begin, end - begin);
+}
+
+/* Parallel vec3_normalize_array (dst may alias src). */
+static void vec3_normalize_array_parallel(parallel_pool *pool, const vec3 *src, vec3 *dst, u32 count)
+{
+    parallel_transform_args args;
+    args.src = src;
+    args.dst = dst;
+    parallel_for(pool, count, parallel_grain(sizeof(vec3)), parallel_vec3_normalize_task, &args);
+}
+
+typedef struct parallel_slerp_args
+{
+    const vec4 *src0;
+    const vec4 *src1;
+    real factor;
+    vec4 *dst;
+} parallel_slerp_args;
+
+static void parallel_quat_slerp_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    parallel_slerp_args *args = (parallel_slerp_args *)user;
+    (void)worker;
+    quat_slerp_array(args->src0 + begin, args->src1 + begin, args->factor, args->dst + begin, end - begin);
+}
+
+/* Parallel quat_slerp_array (dst may alias either source). */
+static void quat_slerp_array_parallel(parallel_pool *pool, const vec4 *src0, const vec4 *src1, real factor, vec4 *dst, u32 count)
+{
+    parallel_slerp_args args;
+    args.src0 = src0;
+    args.src1 = src1;
+    args.factor = factor;
+    args.dst = dst;
+    parallel_for(pool, count, parallel_grain(sizeof(vec4)), parallel_quat_slerp_task, &args);
+}
+
+typedef struct parallel_aabb_args
+{
+    const vec3 *points;
+    parallel_mutex lock;
+    vec3 minimum;
+    vec3 maximum;
+} parallel_aabb_args;
+
+static void parallel_vec3_aabb_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    parallel_aabb_args *args = (parallel_aabb_args *)user;
+    vec3 minimum, maximum;
+    (void)worker;
+    vec3_aabb_array(args->points + begin, end - begin, &minimum, &maximum);
+    /* min/max are exact, so the merge order does not change the result. */
+    parallel_mutex_lock(&args->lock);
+    args->minimum = vec3_min(args->minimum, minimum);
+    args->maximum = vec3_max(args->maximum, maximum);
+    parallel_mutex_unlock(&args->lock);
+}
+
+/* Parallel vec3_aabb_array (count must be non-zero). */
+static void vec3_aabb_array_parallel(parallel_pool *pool, const vec3 *points, u32 count, vec3 *minimum, vec3 *maximum)
+{
+    parallel_aabb_args args;
+    args.points = points;
+    args.minimum = points[0];
+    args.maximum = points[0];
+    parallel_mutex_init(&args.lock);
+    parallel_for(pool, count, parallel_grain(sizeof(vec3)), parallel_vec3_aabb_task, &args);
+    parallel_mutex_destroy(&args.lock);
+    *minimum = args.minimum;
+    *maximum = args.maximum;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_PARALLEL_H */
@@ -0,0 +1,137 @@
+#if !defined(VECTORS_PARTICLES_H)
+#define VECTORS_PARTICLES_H
+
+#include "vectors.h"
+
+/* -------------------------------------------------------------------------
+    User configuration - define before including this header.
+    VECTORS_PARTICLES_STREAMING     write particles_update output with
+                                    non-temporal (cache-bypassing) stores
+                                    on SSE2 targets. Worth it when `dst` is
+                                    a separate buffer that is not read back
+                                    until the next frame.
+   ------------------------------------------------------------------------- */
+#if defined(VECTORS_PARTICLES_STREAMING) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define VECTORS_PARTICLES_NON_TEMPORAL 1
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Particles - one array per field. `life` counts down in seconds and the
+   particle dies when it reaches zero; `inverse_lifetime` (1 / initial life)
+   gives the normalized age used for the color ramp.
+   ------------------------------------------------------------------------- */
+
+typedef struct particles
+{
+    u32 count;
+    u32 capacity;
+    vec3 *position;
+    vec3 *velocity;
+    vec4 *color;
+    real *life;
+    real *inverse_lifetime;
+} particles;
+
+/* Parameters of one particles_update step. */
+typedef struct particle_update
+{
+    vec3 gravity;
+    real drag;              /* fraction of velocity lost per second */
+    vec4 color_start;       /* color at birth */
+    vec4 color_end;         /* color at death */
+    real dt;
+} particle_update;
+
+/* Store one real, bypassing the cache when VECTORS_PARTICLES_STREAMING is enabled. */
+static void particles_store(real *dst, real value)
+{
+#if defined(VECTORS_PARTICLES_NON_TEMPORAL)
+    union { real value; int bits; } cast;
+    cast.value = value;
+    _mm_stream_si32((int *)dst, cast.bits);
+#else
+    *dst = value;
+#endif
+}
+
+/* Append a particle born with settings->color_start; returns false when the set is full. */
+static bool particles_emit(particles *set, const particle_update *settings, vec3 position, vec3 velocity, real lifetime)
+{
+    u32 index = set->count;
+    if (index >= set->capacity || lifetime <= 0.0f)
+    {
+        return BOOL(0);
+    }
+    set->position[index] = position;
+    set->velocity[index] = velocity;
+    set->life[index] = lifetime;
+    set->inverse_lifetime[index] = 1.0f / lifetime;
+    set->color[index] = settings->color_start;
+    set->count = index + 1;
+    return BOOL(1);
+}
+
+/* One fused pass over `src`: age, apply gravity and drag, integrate (semi-implicit Euler), ramp the color
+   from color_start to color_end with vec4_lerp and write the survivors to the front of `dst` in order.
+   Color is only written, never read. `dst` may be `src` (in-place compaction) or a second buffer with at
+   least src->count capacity. Returns the number of live particles (also stored in dst->count). */
+static u32 particles_update(const particles *src, particles *dst, const particle_update *settings)
+{
+    real dt = settings->dt;
+    real damping = 1.0f - settings->drag * dt;
+    vec3 gravity_step = vec3_mul_scalar(settings->gravity, dt);
+    vec3 step = vec3_init_from_1(dt);
+    u32 alive = 0;
+    u32 i;
+
+    damping = damping > 0.0f ? damping : 0.0f;
+    for (i = 0; i < src->count; i++)
+    {
+        real life = src->life[i] - dt;
+        real inverse_lifetime = src->inverse_lifetime[i];
+        vec3 velocity;
+        vec3 position;
+        vec4 color;
+
+        if (life <= 0.0f)
+        {
+            continue;
+        }
+
+        velocity = vec3_fma(src->velocity[i], vec3_init_from_1(damping), gravity_step);
+        position = vec3_fma(velocity, step, src->position[i]);
+        color = vec4_lerp(settings->color_start, settings->color_end, 1.0f - life * inverse_lifetime);
+
+        particles_store(&dst->position[alive].components[0], position.components[0]);
+        particles_store(&dst->position[alive].components[1], position.components[1]);
+        particles_store(&dst->position[alive].components[2], position.components[2]);
+        particles_store(&dst->velocity[alive].components[0], velocity.components[0]);
+        particles_store(&dst->velocity[alive].components[1], velocity.components[1]);
+        particles_store(&dst->velocity[alive].components[2], velocity.components[2]);
+        particles_store(&dst->color[alive].components[0], color.components[0]);
+        particles_store(&dst->color[alive].components[1], color.components[1]);
+        particles_store(&dst->color[alive].components[2], color.components[2]);
+        particles_store(&dst->color[alive].components[3], color.components[3]);
+        particles_store(&dst->life[alive], life);
+        particles_store(&dst->inverse_lifetime[alive], inverse_lifetime);
+        alive++;
+    }
+
+#if defined(VECTORS_PARTICLES_NON_TEMPORAL)
+    /* Make the streamed stores visible before anyone reads dst. */
+    _mm_sfence();
+#endif
+    dst->count = alive;
+    return alive;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_PARTICLES_H */
@@ -0,0 +1,375 @@
+#if !defined(VECTORS_POLYGON_H)
+#define VECTORS_POLYGON_H
+
+#include <stddef.h>
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Simple polygons on vec2 arrays - one closed contour, the last vertex
+   connects back to the first, either winding unless noted:
+       polygon_triangulate   ear clipping
+       polygon_winding       winding number of a point (non-zero inside);
+                             batched, and banded for many points per polygon
+       polygon_clip_*        Sutherland-Hodgman clipping to a line or a
+                             convex polygon
+   ------------------------------------------------------------------------- */
+
+/* Twice the signed area; positive for counter-clockwise polygons. */
+static real polygon_signed_area2(const vec2 *polygon, u32 count)
+{
+    real area = 0.0f;
+    u32 i, j;
+    for (i = 0, j = count - 1; i < count; j = i++)
+    {
+        area += vec2_perp(polygon[j], polygon[i]);
+    }
+    return count > 0 ? area : 0.0f;
+}
+
+/* ---- triangulation ---- */
+
+/* Whether `point` lies inside or on triangle a, b, c of orientation `sign` (+1 counter-clockwise). */
+static bool polygon_triangle_contains(vec2 a, vec2 b, vec2 c, vec2 point, real sign)
+{
+    return sign * vec2_perp(vec2_sub(b, a), vec2_sub(point, a)) >= 0.0f &&
+           sign * vec2_perp(vec2_sub(c, b), vec2_sub(point, b)) >= 0.0f &&
+           sign * vec2_perp(vec2_sub(a, c), vec2_sub(point, c)) >= 0.0f;
+}
+
+/* Triangulate a simple polygon into `triangles` (3 * (count - 2) indices, same winding as the polygon).
+   `scratch` holds 2 * count entries. Degenerate input still yields count - 2 triangles, some of them
+   possibly slivers. Returns the triangle count. O(count^2). */
+static u32 polygon_triangulate(const vec2 *polygon, u32 count, u32 *scratch, u32 *triangles)
+{
+    u32 *previous = scratch;
+    u32 *next = scratch + count;
+    real sign = polygon_signed_area2(polygon, count) >= 0.0f ? 1.0f : -1.0f;
+    u32 remaining = count, written = 0, stalled = 0, vertex = 0;
+    u32 i;
+
+    if (count < 3)
+    {
+        return 0;
+    }
+    for (i = 0; i < count; i++)
+    {
+        previous[i] = i > 0 ? i - 1 : count - 1;
+        next[i] = i + 1 < count ? i + 1 : 0;
+    }
+    while (remaining > 3)
+    {
+        u32 before = previous[vertex], after = next[vertex];
+        vec2 a = polygon[before], b = polygon[vertex], c = polygon[after];
+        bool ear = sign * vec2_perp(vec2_sub(b, a), vec2_sub(c, b)) > 0.0f;
+        u32 other;
+
+        /* An ear is convex and holds no other remaining vertex (positions shared with its corners do not count). */
+        for (other = next[after]; ear && other != before; other = next[other])
+        {
+            vec2 point = polygon[other];
+            if (vec2_eq(point, a) != MASK_01 && vec2_eq(point, b) != MASK_01 && vec2_eq(point, c) != MASK_01)
+            {
+                ear = !polygon_triangle_contains(a, b, c, point, sign);
+            }
+        }
+        /* After a full lap without an ear the input is degenerate; clip anyway to finish. */
+        if (ear || stalled > remaining)
+        {
+            triangles[written++] = before;
+            triangles[written++] = vertex;
+            triangles[written++] = after;
+            next[before] = after;
+            previous[after] = before;
+            remaining--;
+            stalled = 0;
+            vertex = before;
+        }
+        else
+        {
+            stalled++;
+            vertex = after;
+        }
+    }
+    triangles[written++] = previous[vertex];
+    triangles[written++] = vertex;
+    triangles[written++] = next[vertex];
+    return written / 3;
+}
+
+/* ---- point in polygon ---- */
+
+/* Crossing contribution of edge a -> b for a ray from `point` towards +x: +1 upward with the point on the
+   left, -1 downward with the point on the right. */
+static i32 polygon_edge_winding(vec2 a, vec2 b, vec2 point)
+{
+    real side = vec2_perp(vec2_sub(b, a), vec2_sub(point, a));
+    bool upward = a.position.y <= point.position.y && b.position.y > point.position.y;
+    bool downward = a.position.y > point.position.y && b.position.y <= point.position.y;
+    return (i32)(upward && side > 0.0f) - (i32)(downward && side < 0.0f);
+}
+
+/* Winding number of the polygon around `point`: 0 outside, non-zero inside (+1 for counter-clockwise).
+   Sum over contours for polygons with holes. */
+static i32 polygon_winding(const vec2 *polygon, u32 count, vec2 point)
+{
+    i32 winding = 0;
+    u32 i, j;
+    for (i = 0, j = count - 1; i < count; j = i++)
+    {
+        winding += polygon_edge_winding(polygon[j], polygon[i], point);
+    }
+    return winding;
+}
+
+/* polygon_winding for `point_count` points. */
+static void polygon_winding_array(const vec2 *polygon, u32 count, const vec2 *points, u32 point_count, i32 *winding)
+{
+    u32 i;
+    for (i = 0; i < point_count; i++)
+    {
+        winding[i] = polygon_winding(polygon, count, points[i]);
+    }
+}
+
+/* Horizontal bands over a polygon, each listing the edges that span it, so a query tests only the edges
+   of its own band rather than all of them. Worth it for polygons with many edges and many queries. */
+typedef struct polygon_bands
+{
+    const vec2 *polygon;
+    u32 count;
+    u32 band_count;
+    real minimum_y;
+    real maximum_y;
+    real inverse_height;    /* bands per unit of y */
+    u32 *offsets;           /* band_count + 1 entries; band b's edges are edges[offsets[b], offsets[b + 1]) */
+    u32 *edges;             /* edge i runs from polygon[i] to polygon[(i + 1) % count] */
+} polygon_bands;
+
+/* Band range covered by edge `edge`. */
+static void polygon_bands_edge_range(const polygon_bands *bands, u32 edge, u32 *first, u32 *last)
+{
+    real y0 = bands->polygon[edge].position.y;
+    real y1 = bands->polygon[edge + 1 < bands->count ? edge + 1 : 0].position.y;
+    real low = (real_min(y0, y1) - bands->minimum_y) * bands->inverse_height;
+    real high = (real_max(y0, y1) - bands->minimum_y) * bands->inverse_height;
+    *first = (u32)low;
+    *last = high < (real)bands->band_count ? (u32)high : bands->band_count - 1;
+    *first = *first <= *last ? *first : *last;
+}
+
+/* Set up the band bounds and return how many entries the edge list needs. `offsets` and `edges` are left
+   for polygon_bands_build. */
+static u32 polygon_bands_init(polygon_bands *bands, const vec2 *polygon, u32 count, u32 band_count)
+{
+    u32 total = 0;
+    u32 i;
+    bands->polygon = polygon;
+    bands->count = count;
+    bands->band_count = band_count > 0 ? band_count : 1;
+    bands->minimum_y = count > 0 ? polygon[0].position.y : 0.0f;
+    bands->maximum_y = bands->minimum_y;
+    bands->offsets = NULL;
+    bands->edges = NULL;
+    for (i = 1; i < count; i++)
+    {
+        bands->minimum_y = real_min(bands->minimum_y, polygon[i].position.y);
+        bands->maximum_y = real_max(bands->maximum_y, polygon[i].position.y);
+    }
+    bands->inverse_height = bands->maximum_y > bands->minimum_y ? (real)bands->band_count / (bands->maximum_y - bands->minimum_y) : 0.0f;
+    for (i = 0; i < count; i++)
+    {
+        u32 first, last;
+        polygon_bands_edge_range(bands, i, &first, &last);
+        total += last - first + 1;
+    }
+    return total;
+}
+
+/* Fill the bands by counting sort. `offsets` holds band_count + 1 entries and `edges` the size returned by
+   polygon_bands_init. */
+static void polygon_bands_build(polygon_bands *bands, u32 *offsets, u32 *edges)
+{
+    u32 i, band;
+    bands->offsets = offsets;
+    bands->edges = edges;
+    for (band = 0; band <= bands->band_count; band++)
+    {
+        offsets[band] = 0;
+    }
+    for (i = 0; i < bands->count; i++)
+    {
+        u32 first, last;
+        polygon_bands_edge_range(bands, i, &first, &last);
+        for (band = first; band <= last; band++)
+        {
+            offsets[band + 1]++;
+        }
+    }
+    for (band = 0; band < bands->band_count; band++)
+    {
+        offsets[band + 1] += offsets[band];
+    }
+    /* Place each edge, using offsets[band] as the cursor, then shift the offsets back. */
+    for (i = 0; i < bands->count; i++)
+    {
+        u32 first, last;
+        polygon_bands_edge_range(bands, i, &first, &last);
+        for (band = first; band <= last; band++)
+        {
+            edges[offsets[band]++] = i;
+        }
+    }
+    for (band = bands->band_count; band > 0; band--)
+    {
+        offsets[band] = offsets[band - 1];
+    }
+    offsets[0] = 0;
+}
+
+/* polygon_winding through the bands. */
+static i32 polygon_bands_winding(const polygon_bands *bands, vec2 point)
+{
+    real y = point.position.y;
+    real scaled;
+    i32 winding = 0;
+    u32 band, i;
+    if (y < bands->minimum_y || y >= bands->maximum_y)
+    {
+        return 0;
+    }
+    scaled = (y - bands->minimum_y) * bands->inverse_height;
+    band = scaled < (real)bands->band_count ? (u32)scaled : bands->band_count - 1;
+    for (i = bands->offsets[band]; i < bands->offsets[band + 1]; i++)
+    {
+        u32 edge = bands->edges[i];
+        winding += polygon_edge_winding(bands->polygon[edge], bands->polygon[edge + 1 < bands->count ? edge + 1 : 0], point);
+    }
+    return winding;
+}
+
+/* polygon_bands_winding for `point_count` points. */
+static void polygon_bands_winding_array(const polygon_bands *bands, const vec2 *points, u32 point_count, i32 *winding)
+{
+    u32 i;
+    for (i = 0; i < point_count; i++)
+    {
+        winding[i] = polygon_bands_winding(bands, points[i]);
+    }
+}
+
+/* ---- clipping ---- */
+
+/* Clip a polygon to the left of the directed line a -> b (the inside of a counter-clockwise edge), writing up
+   to `capacity` vertices to `out`. Returns the full output count, at most count + count / 2 + 1, and only
+   count + 1 for convex input. */
+static u32 polygon_clip_line(const vec2 *polygon, u32 count, vec2 a, vec2 b, vec2 *out, u32 capacity)
+{
+    vec2 edge = vec2_sub(b, a);
+    vec2 previous;
+    real previous_side;
+    u32 written = 0;
+    u32 i;
+    if (count == 0)
+    {
+        return 0;
+    }
+    previous = polygon[count - 1];
+    previous_side = vec2_perp(edge, vec2_sub(previous, a));
+    for (i = 0; i < count; i++)
+    {
+        vec2 current = polygon[i];
+        real side = vec2_perp(edge, vec2_sub(current, a));
+        if ((side >= 0.0f) != (previous_side >= 0.0f))
+        {
+            if (written < capacity)
+            {
+                out[written] = vec2_lerp(previous, current, previous_side / (previous_side - side));
+            }
+            written++;
+        }
+        if (side >= 0.0f)
+        {
+            if (written < capacity)
+            {
+                out[written] = current;
+            }
+            written++;
+        }
+        previous = current;
+        previous_side = side;
+    }
+    return written;
+}
+
+/* Clip `subject` (any simple polygon) to a convex polygon `clip` of either winding. `scratch` and `out` hold
+   `capacity` vertices each. Returns the output count, or a count above `capacity` when the buffers were
+   too small for some pass (the output is then incomplete; retry with larger buffers). */
+static u32 polygon_clip_convex(const vec2 *subject, u32 count, const vec2 *clip, u32 clip_count, vec2 *scratch, vec2 *out, u32 capacity)
+{
+    bool clockwise = polygon_signed_area2(clip, clip_count) < 0.0f;
+    const vec2 *source = subject;
+    u32 i;
+    for (i = 0; i < clip_count && count > 0; i++)
+    {
+        /* Alternate buffers so the last pass lands in `out`. */
+        vec2 *target = (clip_count - 1 - i) % 2 == 0 ? out : scratch;
+        vec2 a = clip[i];
+        vec2 b = clip[i + 1 < clip_count ? i + 1 : 0];
+        count = clockwise ? polygon_clip_line(source, count, b, a, target, capacity)
+                          : polygon_clip_line(source, count, a, b, target, capacity);
+        if (count > capacity)
+        {
+            return count;
+        }
+        source = target;
+    }
+    if (source != out)
+    {
+        /* Stopped early with an empty result, or there were no clip edges. */
+        for (i = 0; i < count && i < capacity; i++)
+        {
+            out[i] = source[i];
+        }
+    }
+    return count;
+}
+
+#if defined(VECTORS_PARALLEL_H)
+/* -------------------------------------------------------------------------
+   Parallel forms - point ranges on a parallel_pool (vectors_parallel.h)
+   ------------------------------------------------------------------------- */
+
+typedef struct polygon_parallel_args
+{
+    const polygon_bands *bands;
+    const vec2 *points;
+    i32 *winding;
+} polygon_parallel_args;
+
+static void polygon_bands_winding_task(void *user, u32 begin, u32 end, u32 worker)
+{
+    polygon_parallel_args *args = (polygon_parallel_args *)user;
+    (void)worker;
+    polygon_bands_winding_array(args->bands, args->points + begin, end - begin, args->winding + begin);
+}
+
+/* polygon_bands_winding_array split over the pool. */
+static void polygon_bands_winding_parallel(parallel_pool *pool, const polygon_bands *bands, const vec2 *points, u32 point_count, i32 *winding)
+{
+    polygon_parallel_args args;
+    args.bands = bands;
+    args.points = points;
+    args.winding = winding;
+    parallel_for(pool, point_count, parallel_grain(sizeof(vec2)), polygon_bands_winding_task, &args);
+}
+#endif /* VECTORS_PARALLEL_H */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_POLYGON_H */
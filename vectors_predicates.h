@@ -0,0 +1,323 @@
+#if !defined(VECTORS_PREDICATES_H)
+#define VECTORS_PREDICATES_H
+
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Robust geometric predicates - exact signs for float coordinates:
+       predicate_orient2d   > 0 when a, b, c turn counter-clockwise
+       predicate_orient3d   > 0 when d lies below the plane of a, b, c
+                            (a, b, c counter-clockwise seen from above)
+       predicate_incircle   > 0 when d lies inside the circle through a, b, c
+                            (a, b, c counter-clockwise)
+   Each returns -1, 0 or +1. The determinant is first evaluated in float
+   with Shewchuk's forward error bound; only results too close to zero to
+   trust (or that overflowed) are recomputed exactly. The exact stage
+   expands the determinant over the raw coordinates: a product of two
+   floats is exact in double, longer products are split into exact
+   partial products, and the terms are summed as a floating-point
+   expansion. Like Shewchuk's, the float stage assumes no underflow;
+   overflow is caught and sent to the exact stage, which handles any
+   finite input. Requires IEEE double arithmetic without extended
+   precision (SSE2 on x86, not x87) and without -ffast-math style
+   reassociation.
+   ------------------------------------------------------------------------- */
+
+/* Float unit roundoff (2^-24) and the filter bounds derived from it. */
+#define PREDICATE_EPSILON ((real)5.9604644775390625e-8)
+#define PREDICATE_ORIENT2D_BOUND ((3.0f + 16.0f * PREDICATE_EPSILON) * PREDICATE_EPSILON)
+#define PREDICATE_ORIENT3D_BOUND ((7.0f + 56.0f * PREDICATE_EPSILON) * PREDICATE_EPSILON)
+#define PREDICATE_INCIRCLE_BOUND ((10.0f + 96.0f * PREDICATE_EPSILON) * PREDICATE_EPSILON)
+
+/* ---- exact arithmetic ---- */
+
+/* Add `value` to an expansion (nonoverlapping components, increasing magnitude) of `length` components
+   by a chain of exact two-sums, dropping zero components. Returns the new length (at most length + 1). */
+static u32 predicate_grow(double *expansion, u32 length, double value)
+{
+    double total = value;
+    u32 written = 0;
+    u32 i;
+    for (i = 0; i < length; i++)
+    {
+        double component = expansion[i];
+        double sum = total + component;
+        double component_part = sum - total;
+        double total_part = sum - component_part;
+        double error = (total - total_part) + (component - component_part);
+        total = sum;
+        if (error != 0.0)
+        {
+            expansion[written++] = error;
+        }
+    }
+    if (total != 0.0)
+    {
+        expansion[written++] = total;
+    }
+    return written;
+}
+
+/* Sign of an expansion: the sign of its largest component. */
+static i32 predicate_sign(const double *expansion, u32 length)
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+    return expansion[length - 1] > 0.0 ? 1 : -1;
+}
+
+/* Split a double of at most 48 significant bits into two parts of at most 24 bits each, so products of
+   a part with another such part are exact. Done on the bits to stay clear of FMA contraction. */
+static void predicate_split(double value, double *high, double *low)
+{
+    union { double value; u64 bits; } cast;
+    cast.value = value;
+    cast.bits &= ~(u64)0x1FFFFFFF;
+    *high = cast.value;
+    *low = value - cast.value;
+}
+
+/* Parity of a permutation of 0..3 (+1 even, -1 odd). */
+static i32 predicate_parity(u32 i, u32 j, u32 k, u32 l)
+{
+    u32 inversions = (u32)(i > j) + (u32)(i > k) + (u32)(i > l) + (u32)(j > k) + (u32)(j > l) + (u32)(k > l);
+    return (inversions & 1) ? -1 : 1;
+}
+
+/* Exact orient2d: the 3x3 determinant of rows (x, y, 1), expanded into six float products. */
+static i32 predicate_orient2d_exact(vec2 a, vec2 b, vec2 c)
+{
+    const vec2 *rows[3];
+    double expansion[6];
+    u32 length = 0;
+    u32 i, j;
+    rows[0] = &a;
+    rows[1] = &b;
+    rows[2] = &c;
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 3; j++)
+        {
+            if (i != j)
+            {
+                double term = (double)rows[i]->position.x * (double)rows[j]->position.y;
+                length = predicate_grow(expansion, length, predicate_parity(i, j, 3 - i - j, 3) > 0 ? term : -term);
+            }
+        }
+    }
+    return predicate_sign(expansion, length);
+}
+
+/* Exact orient3d: the 4x4 determinant of rows (x, y, z, 1), expanded into 24 triple products of two
+   exact parts each. */
+static i32 predicate_orient3d_exact(vec3 a, vec3 b, vec3 c, vec3 d)
+{
+    const vec3 *rows[4];
+    double expansion[48];
+    u32 length = 0;
+    u32 i, j, k;
+    rows[0] = &a;
+    rows[1] = &b;
+    rows[2] = &c;
+    rows[3] = &d;
+    for (i = 0; i < 4; i++)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            for (k = 0; k < 4; k++)
+            {
+                if (i != j && j != k && i != k)
+                {
+                    double z = (double)rows[k]->position.z;
+                    double high, low;
+                    predicate_split((double)rows[i]->position.x * (double)rows[j]->position.y, &high, &low);
+                    if (predicate_parity(i, j, k, 6 - i - j - k) < 0)
+                    {
+                        high = -high;
+                        low = -low;
+                    }
+                    length = predicate_grow(expansion, length, high * z);
+                    length = predicate_grow(expansion, length, low * z);
+                }
+            }
+        }
+    }
+    return predicate_sign(expansion, length);
+}
+
+/* Exact incircle: the 4x4 determinant of rows (x, y, x^2 + y^2, 1), expanded into 48 products of four
+   coordinates, each split into four exact parts. */
+static i32 predicate_incircle_exact(vec2 a, vec2 b, vec2 c, vec2 d)
+{
+    const vec2 *rows[4];
+    double expansion[192];
+    u32 length = 0;
+    u32 i, j, k, axis;
+    rows[0] = &a;
+    rows[1] = &b;
+    rows[2] = &c;
+    rows[3] = &d;
+    for (i = 0; i < 4; i++)
+    {
+        for (j = 0; j < 4; j++)
+        {
+            for (k = 0; k < 4; k++)
+            {
+                if (i != j && j != k && i != k)
+                {
+                    double first_high, first_low;
+                    predicate_split((double)rows[i]->position.x * (double)rows[j]->position.y, &first_high, &first_low);
+                    if (predicate_parity(i, j, k, 6 - i - j - k) < 0)
+                    {
+                        first_high = -first_high;
+                        first_low = -first_low;
+                    }
+                    for (axis = 0; axis < 2; axis++)
+                    {
+                        double lift = (double)rows[k]->components[axis];
+                        double second_high, second_low;
+                        predicate_split(lift * lift, &second_high, &second_low);
+                        length = predicate_grow(expansion, length, first_high * second_high);
+                        length = predicate_grow(expansion, length, first_high * second_low);
+                        length = predicate_grow(expansion, length, first_low * second_high);
+                        length = predicate_grow(expansion, length, first_low * second_low);
+                    }
+                }
+            }
+        }
+    }
+    return predicate_sign(expansion, length);
+}
+
+/* ---- filtered predicates ---- */
+
+/* Sign of `determinant` when it clears `bound`, else 0 (undecided; NaN from overflow is undecided too). */
+static i32 predicate_filter(real determinant, real bound)
+{
+    return (i32)(determinant > bound) - (i32)(-determinant > bound);
+}
+
+/* Float-filtered orient2d: the sign, or 0 when the float determinant is too close to zero to trust. */
+static i32 predicate_orient2d_filter(vec2 a, vec2 b, vec2 c)
+{
+    real left = (a.position.x - c.position.x) * (b.position.y - c.position.y);
+    real right = (a.position.y - c.position.y) * (b.position.x - c.position.x);
+    return predicate_filter(left - right, PREDICATE_ORIENT2D_BOUND * (real_abs(left) + real_abs(right)));
+}
+
+/* Float-filtered orient3d, as predicate_orient2d_filter. */
+static i32 predicate_orient3d_filter(vec3 a, vec3 b, vec3 c, vec3 d)
+{
+    vec3 ad = vec3_sub(a, d), bd = vec3_sub(b, d), cd = vec3_sub(c, d);
+    real bdx_cdy = bd.position.x * cd.position.y, cdx_bdy = cd.position.x * bd.position.y;
+    real cdx_ady = cd.position.x * ad.position.y, adx_cdy = ad.position.x * cd.position.y;
+    real adx_bdy = ad.position.x * bd.position.y, bdx_ady = bd.position.x * ad.position.y;
+    real determinant = ad.position.z * (bdx_cdy - cdx_bdy) + bd.position.z * (cdx_ady - adx_cdy) + cd.position.z * (adx_bdy - bdx_ady);
+    real permanent = (real_abs(bdx_cdy) + real_abs(cdx_bdy)) * real_abs(ad.position.z) +
+                     (real_abs(cdx_ady) + real_abs(adx_cdy)) * real_abs(bd.position.z) +
+                     (real_abs(adx_bdy) + real_abs(bdx_ady)) * real_abs(cd.position.z);
+    return predicate_filter(determinant, PREDICATE_ORIENT3D_BOUND * permanent);
+}
+
+/* Float-filtered incircle, as predicate_orient2d_filter. */
+static i32 predicate_incircle_filter(vec2 a, vec2 b, vec2 c, vec2 d)
+{
+    vec2 ad = vec2_sub(a, d), bd = vec2_sub(b, d), cd = vec2_sub(c, d);
+    real bdx_cdy = bd.position.x * cd.position.y, cdx_bdy = cd.position.x * bd.position.y;
+    real cdx_ady = cd.position.x * ad.position.y, adx_cdy = ad.position.x * cd.position.y;
+    real adx_bdy = ad.position.x * bd.position.y, bdx_ady = bd.position.x * ad.position.y;
+    real a_lift = ad.position.x * ad.position.x + ad.position.y * ad.position.y;
+    real b_lift = bd.position.x * bd.position.x + bd.position.y * bd.position.y;
+    real c_lift = cd.position.x * cd.position.x + cd.position.y * cd.position.y;
+    real determinant = a_lift * (bdx_cdy - cdx_bdy) + b_lift * (cdx_ady - adx_cdy) + c_lift * (adx_bdy - bdx_ady);
+    real permanent = (real_abs(bdx_cdy) + real_abs(cdx_bdy)) * a_lift +
+                     (real_abs(cdx_ady) + real_abs(adx_cdy)) * b_lift +
+                     (real_abs(adx_bdy) + real_abs(bdx_ady)) * c_lift;
+    return predicate_filter(determinant, PREDICATE_INCIRCLE_BOUND * permanent);
+}
+
+static i32 predicate_orient2d(vec2 a, vec2 b, vec2 c)
+{
+    i32 sign = predicate_orient2d_filter(a, b, c);
+    return sign != 0 ? sign : predicate_orient2d_exact(a, b, c);
+}
+
+static i32 predicate_orient3d(vec3 a, vec3 b, vec3 c, vec3 d)
+{
+    i32 sign = predicate_orient3d_filter(a, b, c, d);
+    return sign != 0 ? sign : predicate_orient3d_exact(a, b, c, d);
+}
+
+static i32 predicate_incircle(vec2 a, vec2 b, vec2 c, vec2 d)
+{
+    i32 sign = predicate_incircle_filter(a, b, c, d);
+    return sign != 0 ? sign : predicate_incircle_exact(a, b, c, d);
+}
+
+/* ---- batched forms ---- */
+
+/* The batches run the float filter over the whole array first, in a branch-free loop that vectorizes, and
+   then revisit only the undecided entries. */
+
+/* predicate_orient2d(a, b, points[i]) for `count` points. */
+static void predicate_orient2d_array(vec2 a, vec2 b, const vec2 *points, u32 count, i32 *signs)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        signs[i] = predicate_orient2d_filter(a, b, points[i]);
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (signs[i] == 0)
+        {
+            signs[i] = predicate_orient2d_exact(a, b, points[i]);
+        }
+    }
+}
+
+/* predicate_orient3d(a, b, c, points[i]) for `count` points. */
+static void predicate_orient3d_array(vec3 a, vec3 b, vec3 c, const vec3 *points, u32 count, i32 *signs)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        signs[i] = predicate_orient3d_filter(a, b, c, points[i]);
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (signs[i] == 0)
+        {
+            signs[i] = predicate_orient3d_exact(a, b, c, points[i]);
+        }
+    }
+}
+
+/* predicate_incircle(a, b, c, points[i]) for `count` points. */
+static void predicate_incircle_array(vec2 a, vec2 b, vec2 c, const vec2 *points, u32 count, i32 *signs)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        signs[i] = predicate_incircle_filter(a, b, c, points[i]);
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (signs[i] == 0)
+        {
+            signs[i] = predicate_incircle_exact(a, b, c, points[i]);
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_PREDICATES_H */
@@ -0,0 +1,160 @@
+#if !defined(VECTORS_RIGID_BODY_H)
+#define VECTORS_RIGID_BODY_H
+
+#include <stddef.h>
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Rigid bodies - state stored as parallel arrays (one array per field), all
+   in world space except `inverse_inertia`, which is the body-space inverse
+   inertia tensor (e.g. mat3_inverse_diagonal of the principal moments).
+   `force` and `torque` are the world-space sums accumulated for this step;
+   either may be NULL. Bodies with inverse_mass == 0 are static (no gravity).
+   Every integrator works on the index range [begin, end) so chunks can be
+   handed to parallel_for (see vectors_parallel.h).
+   ------------------------------------------------------------------------- */
+
+typedef struct rigid_bodies
+{
+    u32 count;
+    vec3 *position;
+    vec4 *orientation;          /* unit quaternion (i, j, k, w) */
+    vec3 *linear_velocity;
+    vec3 *angular_velocity;     /* radians per second */
+    real *inverse_mass;
+    mat3 *inverse_inertia;
+    const vec3 *force;
+    const vec3 *torque;
+} rigid_bodies;
+
+/* Linear acceleration of body `index` from its accumulated force plus gravity. */
+static vec3 rigid_bodies_linear_acceleration(const rigid_bodies *bodies, u32 index, vec3 gravity)
+{
+    real inverse_mass = bodies->inverse_mass[index];
+    vec3 acceleration = inverse_mass > 0.0f ? gravity : vec3_init_from_1(0.0f);
+    if (bodies->force != NULL)
+    {
+        acceleration = vec3_fma(bodies->force[index], vec3_init_from_1(inverse_mass), acceleration);
+    }
+    return acceleration;
+}
+
+/* Accumulated torque of body `index` (zero when no torque array is given). */
+static vec3 rigid_bodies_torque(const rigid_bodies *bodies, u32 index)
+{
+    return bodies->torque != NULL ? bodies->torque[index] : vec3_init_from_1(0.0f);
+}
+
+/* World-space angular acceleration from torque only: R * inverse_inertia * R^T * torque. */
+static vec3 rigid_body_angular_acceleration(vec4 orientation, mat3 inverse_inertia, vec3 torque)
+{
+    mat3 rotation = mat3_from_quat(orientation);
+    vec3 body_torque = mat3_mul_vec3(mat3_transpose(rotation), torque);
+    vec3 body_acceleration = mat3_mul_vec3(inverse_inertia, body_torque);
+    return mat3_mul_vec3(rotation, body_acceleration);
+}
+
+/* Angular state derivative including the gyroscopic term (Euler's equations in body space).
+   Assumes a diagonal body-space inverse inertia; zero entries are treated as locked axes. */
+static void rigid_body_angular_derivative(vec4 orientation, vec3 angular_velocity, mat3 inverse_inertia, vec3 torque,
+                                          vec4 *orientation_rate, vec3 *angular_acceleration)
+{
+    mat3 rotation = mat3_from_quat(vec4_normalize(orientation));
+    mat3 inverse_rotation = mat3_transpose(rotation);
+    mat3 inertia = mat3_inverse_diagonal(inverse_inertia);
+    vec3 body_velocity = mat3_mul_vec3(inverse_rotation, angular_velocity);
+    vec3 body_torque = mat3_mul_vec3(inverse_rotation, torque);
+    vec3 body_momentum = mat3_mul_vec3(inertia, body_velocity);
+    vec3 gyroscopic = vec3_cross(body_velocity, body_momentum);
+    vec3 body_acceleration = mat3_mul_vec3(inverse_inertia, vec3_sub(body_torque, gyroscopic));
+    *angular_acceleration = mat3_mul_vec3(rotation, body_acceleration);
+    *orientation_rate = quat_derivative(orientation, angular_velocity);
+}
+
+/* Semi-implicit (symplectic) Euler: velocities first, then positions and orientations from the new velocities. */
+static void rigid_bodies_integrate_euler(rigid_bodies *bodies, u32 begin, u32 end, vec3 gravity, real dt)
+{
+    vec3 step = vec3_init_from_1(dt);
+    u32 i;
+    for (i = begin; i < end; i++)
+    {
+        vec3 linear_acceleration = rigid_bodies_linear_acceleration(bodies, i, gravity);
+        vec3 angular_acceleration = rigid_body_angular_acceleration(bodies->orientation[i], bodies->inverse_inertia[i], rigid_bodies_torque(bodies, i));
+        bodies->linear_velocity[i] = vec3_fma(linear_acceleration, step, bodies->linear_velocity[i]);
+        bodies->angular_velocity[i] = vec3_fma(angular_acceleration, step, bodies->angular_velocity[i]);
+        bodies->position[i] = vec3_fma(bodies->linear_velocity[i], step, bodies->position[i]);
+        bodies->orientation[i] = quat_integrate(bodies->orientation[i], bodies->angular_velocity[i], dt);
+    }
+}
+
+/* Position Verlet for the linear part (x' = 2x - x_prev + a dt^2) using `previous_position`, which is
+   updated in place; linear_velocity is rewritten as (x' - x) / dt. Rotation uses semi-implicit Euler.
+   Seed previous_position with position - linear_velocity * dt before the first step. */
+static void rigid_bodies_integrate_verlet(rigid_bodies *bodies, vec3 *previous_position, u32 begin, u32 end, vec3 gravity, real dt)
+{
+    vec3 step = vec3_init_from_1(dt);
+    vec3 step_squared = vec3_init_from_1(dt * dt);
+    real rcp_dt = 1.0f / dt;
+    u32 i;
+    for (i = begin; i < end; i++)
+    {
+        vec3 linear_acceleration = rigid_bodies_linear_acceleration(bodies, i, gravity);
+        vec3 angular_acceleration = rigid_body_angular_acceleration(bodies->orientation[i], bodies->inverse_inertia[i], rigid_bodies_torque(bodies, i));
+        vec3 current = bodies->position[i];
+        vec3 displacement = vec3_fma(linear_acceleration, step_squared, vec3_sub(current, previous_position[i]));
+        vec3 next = vec3_add(current, displacement);
+        previous_position[i] = current;
+        bodies->position[i] = next;
+        bodies->linear_velocity[i] = vec3_mul_scalar(displacement, rcp_dt);
+        bodies->angular_velocity[i] = vec3_fma(angular_acceleration, step, bodies->angular_velocity[i]);
+        bodies->orientation[i] = quat_integrate(bodies->orientation[i], bodies->angular_velocity[i], dt);
+    }
+}
+
+/* Classic 4th-order Runge-Kutta. Force and torque are held constant over the step, so the linear part is
+   the exact constant-acceleration update; the orientation and angular velocity are integrated with four
+   derivative evaluations including the gyroscopic term (diagonal inverse_inertia required). */
+static void rigid_bodies_integrate_rk4(rigid_bodies *bodies, u32 begin, u32 end, vec3 gravity, real dt)
+{
+    vec3 step = vec3_init_from_1(dt);
+    vec3 half_step_squared = vec3_init_from_1(0.5f * dt * dt);
+    vec4 half_step4 = vec4_init_from_1(0.5f * dt);
+    vec4 full_step4 = vec4_init_from_1(dt);
+    vec4 sixth_step4 = vec4_init_from_1(dt / 6.0f);
+    vec3 half_step3 = vec3_init_from_1(0.5f * dt);
+    vec3 sixth_step3 = vec3_init_from_1(dt / 6.0f);
+    u32 i;
+    for (i = begin; i < end; i++)
+    {
+        vec3 linear_acceleration = rigid_bodies_linear_acceleration(bodies, i, gravity);
+        vec3 torque = rigid_bodies_torque(bodies, i);
+        mat3 inverse_inertia = bodies->inverse_inertia[i];
+        vec4 q = bodies->orientation[i];
+        vec3 w = bodies->angular_velocity[i];
+        vec4 dq1, dq2, dq3, dq4, dq_sum;
+        vec3 dw1, dw2, dw3, dw4, dw_sum;
+
+        rigid_body_angular_derivative(q, w, inverse_inertia, torque, &dq1, &dw1);
+        rigid_body_angular_derivative(vec4_fma(dq1, half_step4, q), vec3_fma(dw1, half_step3, w), inverse_inertia, torque, &dq2, &dw2);
+        rigid_body_angular_derivative(vec4_fma(dq2, half_step4, q), vec3_fma(dw2, half_step3, w), inverse_inertia, torque, &dq3, &dw3);
+        rigid_body_angular_derivative(vec4_fma(dq3, full_step4, q), vec3_fma(dw3, step, w), inverse_inertia, torque, &dq4, &dw4);
+
+        dq_sum = vec4_add(vec4_add(dq1, dq4), vec4_mul_scalar(vec4_add(dq2, dq3), 2.0f));
+        dw_sum = vec3_add(vec3_add(dw1, dw4), vec3_mul_scalar(vec3_add(dw2, dw3), 2.0f));
+        bodies->orientation[i] = vec4_normalize(vec4_fma(dq_sum, sixth_step4, q));
+        bodies->angular_velocity[i] = vec3_fma(dw_sum, sixth_step3, w);
+
+        bodies->position[i] = vec3_fma(linear_acceleration, half_step_squared, vec3_fma(bodies->linear_velocity[i], step, bodies->position[i]));
+        bodies->linear_velocity[i] = vec3_fma(linear_acceleration, step, bodies->linear_velocity[i]);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_RIGID_BODY_H */
@@ -0,0 +1,243 @@
+#if !defined(VECTORS_SPATIAL_HASH_H)
+#define VECTORS_SPATIAL_HASH_H
+
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Spatial hash - uniform grid of cubic cells keyed on floor(p / cell_size),
+   hashed into a power-of-two bucket table and rebuilt from scratch each
+   frame with a counting sort. Points are copied into bucket order, so a
+   query walks contiguous memory. All buffers are owned by the caller:
+       cell_start       table_size + 1 entries
+       point_bucket     count entries (scratch used by the build)
+       sorted_index     count entries (original index of each sorted point)
+       sorted_position  count entries
+   Results are reported as sorted positions; map them back to the caller's
+   arrays through sorted_index.
+   ------------------------------------------------------------------------- */
+
+typedef struct spatial_hash
+{
+    real cell_size;
+    real inverse_cell_size;
+    u32 table_size;
+    u32 count;
+    u32 *cell_start;
+    u32 *point_bucket;
+    u32 *sorted_index;
+    vec3 *sorted_position;
+} spatial_hash;
+
+/* Integer cell containing a point. */
+static ivec3 spatial_hash_cell(const spatial_hash *grid, vec3 point)
+{
+    return ivec3_from_vec3_floor(vec3_mul_scalar(point, grid->inverse_cell_size));
+}
+
+/* Bucket of an integer cell. */
+static u32 spatial_hash_bucket(const spatial_hash *grid, ivec3 cell)
+{
+    u32 hash = ((u32)cell.components[0] * 73856093u) ^ ((u32)cell.components[1] * 19349663u) ^ ((u32)cell.components[2] * 83492791u);
+    return hash & (grid->table_size - 1);
+}
+
+/* Counting-sort `count` points into buckets (O(count + table_size)). table_size must be a power of two;
+   about 2 * count buckets keeps collisions rare. Points keep their input order inside a bucket. */
+static void spatial_hash_build(spatial_hash *grid, const vec3 *points, u32 count)
+{
+    u32 *cell_start = grid->cell_start;
+    u32 running = 0;
+    u32 i;
+
+    grid->inverse_cell_size = 1.0f / grid->cell_size;
+    grid->count = count;
+    for (i = 0; i <= grid->table_size; i++)
+    {
+        cell_start[i] = 0;
+    }
+    for (i = 0; i < count; i++)
+    {
+        u32 bucket = spatial_hash_bucket(grid, spatial_hash_cell(grid, points[i]));
+        grid->point_bucket[i] = bucket;
+        cell_start[bucket]++;
+    }
+
+    /* Inclusive prefix sum: cell_start[b] is the end of bucket b ... */
+    for (i = 0; i < grid->table_size; i++)
+    {
+        running += cell_start[i];
+        cell_start[i] = running;
+    }
+    cell_start[grid->table_size] = count;
+
+    /* ... and scattering backwards walks it down to the start, keeping the sort stable. */
+    for (i = count; i-- > 0;)
+    {
+        u32 slot = --cell_start[grid->point_bucket[i]];
+        grid->sorted_index[slot] = i;
+        grid->sorted_position[slot] = points[i];
+    }
+}
+
+/* Write the sorted positions of every point within `radius` of `center` into `out` (at most `capacity`).
+   Returns the total number found, which may exceed capacity. */
+static u32 spatial_hash_query_radius(const spatial_hash *grid, vec3 center, real radius, u32 *out, u32 capacity)
+{
+    real radius_squared = radius * radius;
+    ivec3 lower = spatial_hash_cell(grid, vec3_sub_scalar(center, radius));
+    ivec3 upper = spatial_hash_cell(grid, vec3_add_scalar(center, radius));
+    ivec3 cell;
+    u32 found = 0;
+
+    for (cell.components[2] = lower.components[2]; cell.components[2] <= upper.components[2]; cell.components[2]++)
+    for (cell.components[1] = lower.components[1]; cell.components[1] <= upper.components[1]; cell.components[1]++)
+    for (cell.components[0] = lower.components[0]; cell.components[0] <= upper.components[0]; cell.components[0]++)
+    {
+        u32 bucket = spatial_hash_bucket(grid, cell);
+        u32 end = grid->cell_start[bucket + 1];
+        u32 slot;
+        for (slot = grid->cell_start[bucket]; slot < end; slot++)
+        {
+            vec3 offset = vec3_sub(grid->sorted_position[slot], center);
+            if (vec3_dot(offset, offset) > radius_squared)
+            {
+                continue;
+            }
+            /* Another cell of the range may share this bucket; only report points that live in `cell`. */
+            if (ivec3_ne(spatial_hash_cell(grid, grid->sorted_position[slot]), cell) != 0)
+            {
+                continue;
+            }
+            if (found < capacity)
+            {
+                out[found] = slot;
+            }
+            found++;
+        }
+    }
+    return found;
+}
+
+/* Insert a candidate into a list kept sorted by distance, holding at most k entries. */
+static u32 spatial_hash_insert_nearest(u32 *indices, real *distances_squared, u32 found, u32 k, u32 slot, real distance_squared)
+{
+    u32 position;
+    if (found == k && distance_squared >= distances_squared[k - 1])
+    {
+        return found;
+    }
+    position = found < k ? found++ : k - 1;
+    while (position > 0 && distances_squared[position - 1] > distance_squared)
+    {
+        indices[position] = indices[position - 1];
+        distances_squared[position] = distances_squared[position - 1];
+        position--;
+    }
+    indices[position] = slot;
+    distances_squared[position] = distance_squared;
+    return found;
+}
+
+/* The k nearest points to `center` no further than `max_radius`, nearest first, as sorted positions and
+   squared distances. Searches rings of cells outwards and stops once no closer point can remain.
+   Returns how many were found (at most k). */
+static u32 spatial_hash_query_nearest(const spatial_hash *grid, vec3 center, u32 k, real max_radius, u32 *indices, real *distances_squared)
+{
+    real max_radius_squared = max_radius * max_radius;
+    ivec3 origin = spatial_hash_cell(grid, center);
+    i32 ring_count = (i32)(max_radius * grid->inverse_cell_size) + 1;
+    i32 ring;
+    u32 found = 0;
+
+    if (k == 0)
+    {
+        return 0;
+    }
+    for (ring = 0; ring <= ring_count; ring++)
+    {
+        real reach = (real)(ring - 1) * grid->cell_size;
+        ivec3 offset;
+        /* Points in this ring or beyond are at least `reach` away, wherever `center` sits in its cell. */
+        if (ring > 0 && found == k && distances_squared[k - 1] <= reach * reach)
+        {
+            break;
+        }
+        if (ring > 0 && reach * reach > max_radius_squared)
+        {
+            break;
+        }
+        for (offset.components[2] = -ring; offset.components[2] <= ring; offset.components[2]++)
+        for (offset.components[1] = -ring; offset.components[1] <= ring; offset.components[1]++)
+        for (offset.components[0] = -ring; offset.components[0] <= ring; offset.components[0]++)
+        {
+            ivec3 shell = ivec3_abs(offset);
+            ivec3 cell;
+            u32 bucket, end, slot;
+            if (shell.components[0] != ring && shell.components[1] != ring && shell.components[2] != ring)
+            {
+                continue;
+            }
+            cell = ivec3_add(origin, offset);
+            bucket = spatial_hash_bucket(grid, cell);
+            end = grid->cell_start[bucket + 1];
+            for (slot = grid->cell_start[bucket]; slot < end; slot++)
+            {
+                vec3 difference = vec3_sub(grid->sorted_position[slot], center);
+                real distance_squared = vec3_dot(difference, difference);
+                if (distance_squared > max_radius_squared)
+                {
+                    continue;
+                }
+                if (ivec3_ne(spatial_hash_cell(grid, grid->sorted_position[slot]), cell) != 0)
+                {
+                    continue;
+                }
+                found = spatial_hash_insert_nearest(indices, distances_squared, found, k, slot, distance_squared);
+            }
+        }
+    }
+    return found;
+}
+
+/* Batched radius query for every point in bucket order (consecutive queries touch the same buckets).
+   Neighbors of sorted point s (itself excluded) are neighbors[offsets[s] .. offsets[s + 1]), as sorted
+   positions; offsets needs count + 1 entries. Returns the total neighbor count - if it exceeds capacity
+   the lists are truncated and the call should be repeated with a larger buffer. */
+static u32 spatial_hash_neighbors(const spatial_hash *grid, real radius, u32 *offsets, u32 *neighbors, u32 capacity)
+{
+    u32 written_total = 0;
+    u32 needed_total = 0;
+    u32 s;
+    for (s = 0; s < grid->count; s++)
+    {
+        u32 *list = neighbors + written_total;
+        u32 room = capacity - written_total;
+        u32 found = spatial_hash_query_radius(grid, grid->sorted_position[s], radius, list, room);
+        u32 written = found < room ? found : room;
+        u32 j;
+        /* Drop the query point itself (always found, at distance zero). */
+        for (j = 0; j < written; j++)
+        {
+            if (list[j] == s)
+            {
+                list[j] = list[--written];
+                break;
+            }
+        }
+        offsets[s] = written_total;
+        written_total += written;
+        needed_total += found - 1;
+    }
+    offsets[grid->count] = written_total;
+    return needed_total;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_SPATIAL_HASH_H */
@@ -0,0 +1,479 @@
+#if !defined(VECTORS_SPLINE_H)
+#define VECTORS_SPLINE_H
+
+#include "vectors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* -------------------------------------------------------------------------
+   Cubic curves - every segment is converted once to power-basis
+   coefficients c0 + c1 t + c2 t^2 + c3 t^3 (a 4x4 basis matrix times the
+   four control values), after which a sample costs three multiply-adds per
+   component (Horner), or three adds with forward differencing.
+   Control point order per basis:
+       SPLINE_CATMULL_ROM  p0 p1 p2 p3, curve runs from p1 to p2
+       SPLINE_HERMITE      p0 m0 p1 m1 (points and tangents)
+       SPLINE_BEZIER       p0 c0 c1 p1, curve runs from p0 to p1
+       SPLINE_BSPLINE      p0 p1 p2 p3, uniform cubic B-spline segment
+   ------------------------------------------------------------------------- */
+
+typedef enum spline_basis
+{
+    SPLINE_CATMULL_ROM = 0,
+    SPLINE_HERMITE = 1,
+    SPLINE_BEZIER = 2,
+    SPLINE_BSPLINE = 3
+} spline_basis;
+
+/* spline_basis_matrix[basis][k][j] - weight of control value j in the t^k coefficient. */
+static const real spline_basis_matrix[4][4][4] =
+{
+    {   /* Catmull-Rom (uniform, tension 0.5) */
+        {  0.0f,  1.0f,  0.0f,  0.0f },
+        { -0.5f,  0.0f,  0.5f,  0.0f },
+        {  1.0f, -2.5f,  2.0f, -0.5f },
+        { -0.5f,  1.5f, -1.5f,  0.5f }
+    },
+    {   /* Hermite */
+        {  1.0f,  0.0f,  0.0f,  0.0f },
+        {  0.0f,  1.0f,  0.0f,  0.0f },
+        { -3.0f, -2.0f,  3.0f, -1.0f },
+        {  2.0f,  1.0f, -2.0f,  1.0f }
+    },
+    {   /* Bezier */
+        {  1.0f,  0.0f,  0.0f,  0.0f },
+        { -3.0f,  3.0f,  0.0f,  0.0f },
+        {  3.0f, -6.0f,  3.0f,  0.0f },
+        { -1.0f,  3.0f, -3.0f,  1.0f }
+    },
+    {   /* uniform B-spline */
+        {  1.0f / 6.0f,  4.0f / 6.0f,  1.0f / 6.0f,  0.0f },
+        { -3.0f / 6.0f,  0.0f,         3.0f / 6.0f,  0.0f },
+        {  3.0f / 6.0f, -6.0f / 6.0f,  3.0f / 6.0f,  0.0f },
+        { -1.0f / 6.0f,  3.0f / 6.0f, -3.0f / 6.0f,  1.0f / 6.0f }
+    }
+};
+
+/* ---- vec2 ---- */
+
+/* Power-basis coefficients of one vec2 segment. */
+static void vec2_cubic_coefficients(spline_basis basis, vec2 p0, vec2 p1, vec2 p2, vec2 p3, vec2 *coefficients)
+{
+    u32 k;
+    for (k = 0; k < 4; k++)
+    {
+        const real *weights = spline_basis_matrix[basis][k];
+        vec2 sum = vec2_mul_scalar(p0, weights[0]);
+        sum = vec2_fma(p1, vec2_init_from_1(weights[1]), sum);
+        sum = vec2_fma(p2, vec2_init_from_1(weights[2]), sum);
+        coefficients[k] = vec2_fma(p3, vec2_init_from_1(weights[3]), sum);
+    }
+}
+
+/* Evaluate a vec2 cubic from its coefficients at t (Horner). */
+static vec2 vec2_cubic_evaluate(const vec2 *coefficients, real t)
+{
+    vec2 step = vec2_init_from_1(t);
+    vec2 value = vec2_fma(coefficients[3], step, coefficients[2]);
+    value = vec2_fma(value, step, coefficients[1]);
+    return vec2_fma(value, step, coefficients[0]);
+}
+
+/* Derivative of a vec2 cubic at t (the curve tangent, not normalized). */
+static vec2 vec2_cubic_derivative(const vec2 *coefficients, real t)
+{
+    vec2 step = vec2_init_from_1(t);
+    vec2 value = vec2_fma(vec2_mul_scalar(coefficients[3], 3.0f), step, vec2_mul_scalar(coefficients[2], 2.0f));
+    return vec2_fma(value, step, coefficients[1]);
+}
+
+/* Evaluate a vec2 cubic at `count` arbitrary parameters. */
+static void vec2_cubic_evaluate_array(const vec2 *coefficients, const real *t, vec2 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec2_cubic_evaluate(coefficients, t[i]);
+    }
+}
+
+/* Evaluate a vec2 cubic at t0, t0 + dt, ... (`count` samples) by forward differencing: three adds per
+   sample. Rounding error grows with count; restart per segment rather than over very long runs. */
+static void vec2_cubic_forward_difference(const vec2 *coefficients, real t0, real dt, vec2 *dst, u32 count)
+{
+    /* Differences of the polynomial re-centred on t0: f'(t0), f''(t0) / 2 and c3, scaled by powers of dt. */
+    real dt_squared = dt * dt;
+    vec2 slope = vec2_cubic_derivative(coefficients, t0);
+    vec2 half_curvature = vec2_fma(coefficients[3], vec2_init_from_1(3.0f * t0), coefficients[2]);
+    vec2 cubic = vec2_mul_scalar(coefficients[3], dt_squared * dt);
+    vec2 delta3 = vec2_mul_scalar(cubic, 6.0f);
+    vec2 delta2 = vec2_fma(half_curvature, vec2_init_from_1(2.0f * dt_squared), delta3);
+    vec2 delta1 = vec2_add(vec2_fma(half_curvature, vec2_init_from_1(dt_squared), vec2_mul_scalar(slope, dt)), cubic);
+    vec2 value = vec2_cubic_evaluate(coefficients, t0);
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = value;
+        value = vec2_add(value, delta1);
+        delta1 = vec2_add(delta1, delta2);
+        delta2 = vec2_add(delta2, delta3);
+    }
+}
+
+/* Catmull-Rom segment from p1 to p2 at t. */
+static vec2 vec2_catmull_rom(vec2 p0, vec2 p1, vec2 p2, vec2 p3, real t)
+{
+    vec2 coefficients[4];
+    vec2_cubic_coefficients(SPLINE_CATMULL_ROM, p0, p1, p2, p3, coefficients);
+    return vec2_cubic_evaluate(coefficients, t);
+}
+
+/* Hermite segment from p0 (tangent m0) to p1 (tangent m1) at t. */
+static vec2 vec2_hermite(vec2 p0, vec2 m0, vec2 p1, vec2 m1, real t)
+{
+    vec2 coefficients[4];
+    vec2_cubic_coefficients(SPLINE_HERMITE, p0, m0, p1, m1, coefficients);
+    return vec2_cubic_evaluate(coefficients, t);
+}
+
+/* Cubic Bezier from p0 to p1 with control points c0, c1 at t. */
+static vec2 vec2_bezier(vec2 p0, vec2 c0, vec2 c1, vec2 p1, real t)
+{
+    vec2 coefficients[4];
+    vec2_cubic_coefficients(SPLINE_BEZIER, p0, c0, c1, p1, coefficients);
+    return vec2_cubic_evaluate(coefficients, t);
+}
+
+/* Uniform cubic B-spline segment of p0..p3 at t. */
+static vec2 vec2_bspline(vec2 p0, vec2 p1, vec2 p2, vec2 p3, real t)
+{
+    vec2 coefficients[4];
+    vec2_cubic_coefficients(SPLINE_BSPLINE, p0, p1, p2, p3, coefficients);
+    return vec2_cubic_evaluate(coefficients, t);
+}
+
+/* Tessellate a curve through `point_count` points (Catmull-Rom or B-spline; the end points are repeated
+   so the curve spans the whole range) into `steps` samples per segment plus the final point.
+   dst needs (point_count - 1) * steps + 1 entries; returns the number written. */
+static u32 vec2_spline_tessellate(spline_basis basis, const vec2 *points, u32 point_count, u32 steps, vec2 *dst)
+{
+    real dt = 1.0f / (real)steps;
+    vec2 coefficients[4];
+    u32 segment;
+    if (point_count < 2 || steps == 0)
+    {
+        return 0;
+    }
+    for (segment = 0; segment + 1 < point_count; segment++)
+    {
+        vec2 p0 = points[segment > 0 ? segment - 1 : 0];
+        vec2 p3 = points[segment + 2 < point_count ? segment + 2 : point_count - 1];
+        vec2_cubic_coefficients(basis, p0, points[segment], points[segment + 1], p3, coefficients);
+        vec2_cubic_forward_difference(coefficients, 0.0f, dt, dst + segment * steps, steps);
+    }
+    dst[segment * steps] = vec2_cubic_evaluate(coefficients, 1.0f);
+    return segment * steps + 1;
+}
+
+/* ---- vec3 ---- */
+
+/* Power-basis coefficients of one vec3 segment. */
+static void vec3_cubic_coefficients(spline_basis basis, vec3 p0, vec3 p1, vec3 p2, vec3 p3, vec3 *coefficients)
+{
+    u32 k;
+    for (k = 0; k < 4; k++)
+    {
+        const real *weights = spline_basis_matrix[basis][k];
+        vec3 sum = vec3_mul_scalar(p0, weights[0]);
+        sum = vec3_fma(p1, vec3_init_from_1(weights[1]), sum);
+        sum = vec3_fma(p2, vec3_init_from_1(weights[2]), sum);
+        coefficients[k] = vec3_fma(p3, vec3_init_from_1(weights[3]), sum);
+    }
+}
+
+/* Evaluate a vec3 cubic from its coefficients at t (Horner). */
+static vec3 vec3_cubic_evaluate(const vec3 *coefficients, real t)
+{
+    vec3 step = vec3_init_from_1(t);
+    vec3 value = vec3_fma(coefficients[3], step, coefficients[2]);
+    value = vec3_fma(value, step, coefficients[1]);
+    return vec3_fma(value, step, coefficients[0]);
+}
+
+/* Derivative of a vec3 cubic at t (the curve tangent, not normalized). */
+static vec3 vec3_cubic_derivative(const vec3 *coefficients, real t)
+{
+    vec3 step = vec3_init_from_1(t);
+    vec3 value = vec3_fma(vec3_mul_scalar(coefficients[3], 3.0f), step, vec3_mul_scalar(coefficients[2], 2.0f));
+    return vec3_fma(value, step, coefficients[1]);
+}
+
+/* Evaluate a vec3 cubic at `count` arbitrary parameters. */
+static void vec3_cubic_evaluate_array(const vec3 *coefficients, const real *t, vec3 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec3_cubic_evaluate(coefficients, t[i]);
+    }
+}
+
+/* Evaluate a vec3 cubic at t0, t0 + dt, ... (`count` samples) by forward differencing: three adds per
+   sample. Rounding error grows with count; restart per segment rather than over very long runs. */
+static void vec3_cubic_forward_difference(const vec3 *coefficients, real t0, real dt, vec3 *dst, u32 count)
+{
+    /* Differences of the polynomial re-centred on t0: f'(t0), f''(t0) / 2 and c3, scaled by powers of dt. */
+    real dt_squared = dt * dt;
+    vec3 slope = vec3_cubic_derivative(coefficients, t0);
+    vec3 half_curvature = vec3_fma(coefficients[3], vec3_init_from_1(3.0f * t0), coefficients[2]);
+    vec3 cubic = vec3_mul_scalar(coefficients[3], dt_squared * dt);
+    vec3 delta3 = vec3_mul_scalar(cubic, 6.0f);
+    vec3 delta2 = vec3_fma(half_curvature, vec3_init_from_1(2.0f * dt_squared), delta3);
+    vec3 delta1 = vec3_add(vec3_fma(half_curvature, vec3_init_from_1(dt_squared), vec3_mul_scalar(slope, dt)), cubic);
+    vec3 value = vec3_cubic_evaluate(coefficients, t0);
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = value;
+        value = vec3_add(value, delta1);
+        delta1 = vec3_add(delta1, delta2);
+        delta2 = vec3_add(delta2, delta3);
+    }
+}
+
+/* Catmull-Rom segment from p1 to p2 at t. */
+static vec3 vec3_catmull_rom(vec3 p0, vec3 p1, vec3 p2, vec3 p3, real t)
+{
+    vec3 coefficients[4];
+    vec3_cubic_coefficients(SPLINE_CATMULL_ROM, p0, p1, p2, p3, coefficients);
+    return vec3_cubic_evaluate(coefficients, t);
+}
+
+/* Hermite segment from p0 (tangent m0) to p1 (tangent m1) at t. */
+static vec3 vec3_hermite(vec3 p0, vec3 m0, vec3 p1, vec3 m1, real t)
+{
+    vec3 coefficients[4];
+    vec3_cubic_coefficients(SPLINE_HERMITE, p0, m0, p1, m1, coefficients);
+    return vec3_cubic_evaluate(coefficients, t);
+}
+
+/* Cubic Bezier from p0 to p1 with control points c0, c1 at t. */
+static vec3 vec3_bezier(vec3 p0, vec3 c0, vec3 c1, vec3 p1, real t)
+{
+    vec3 coefficients[4];
+    vec3_cubic_coefficients(SPLINE_BEZIER, p0, c0, c1, p1, coefficients);
+    return vec3_cubic_evaluate(coefficients, t);
+}
+
+/* Uniform cubic B-spline segment of p0..p3 at t. */
+static vec3 vec3_bspline(vec3 p0, vec3 p1, vec3 p2, vec3 p3, real t)
+{
+    vec3 coefficients[4];
+    vec3_cubic_coefficients(SPLINE_BSPLINE, p0, p1, p2, p3, coefficients);
+    return vec3_cubic_evaluate(coefficients, t);
+}
+
+/* Tessellate a curve through `point_count` points (Catmull-Rom or B-spline; the end points are repeated
+   so the curve spans the whole range) into `steps` samples per segment plus the final point.
+   dst needs (point_count - 1) * steps + 1 entries; returns the number written. */
+static u32 vec3_spline_tessellate(spline_basis basis, const vec3 *points, u32 point_count, u32 steps, vec3 *dst)
+{
+    real dt = 1.0f / (real)steps;
+    vec3 coefficients[4];
+    u32 segment;
+    if (point_count < 2 || steps == 0)
+    {
+        return 0;
+    }
+    for (segment = 0; segment + 1 < point_count; segment++)
+    {
+        vec3 p0 = points[segment > 0 ? segment - 1 : 0];
+        vec3 p3 = points[segment + 2 < point_count ? segment + 2 : point_count - 1];
+        vec3_cubic_coefficients(basis, p0, points[segment], points[segment + 1], p3, coefficients);
+        vec3_cubic_forward_difference(coefficients, 0.0f, dt, dst + segment * steps, steps);
+    }
+    dst[segment * steps] = vec3_cubic_evaluate(coefficients, 1.0f);
+    return segment * steps + 1;
+}
+
+/* ---- vec4 ---- */
+
+/* Power-basis coefficients of one vec4 segment. */
+static void vec4_cubic_coefficients(spline_basis basis, vec4 p0, vec4 p1, vec4 p2, vec4 p3, vec4 *coefficients)
+{
+    u32 k;
+    for (k = 0; k < 4; k++)
+    {
+        const real *weights = spline_basis_matrix[basis][k];
+        vec4 sum = vec4_mul_scalar(p0, weights[0]);
+        sum = vec4_fma(p1, vec4_init_from_1(weights[1]), sum);
+        sum = vec4_fma(p2, vec4_init_from_1(weights[2]), sum);
+        coefficients[k] = vec4_fma(p3, vec4_init_from_1(weights[3]), sum);
+    }
+}
+
+/* Evaluate a vec4 cubic from its coefficients at t (Horner). */
+static vec4 vec4_cubic_evaluate(const vec4 *coefficients, real t)
+{
+    vec4 step = vec4_init_from_1(t);
+    vec4 value = vec4_fma(coefficients[3], step, coefficients[2]);
+    value = vec4_fma(value, step, coefficients[1]);
+    return vec4_fma(value, step, coefficients[0]);
+}
+
+/* Derivative of a vec4 cubic at t (the curve tangent, not normalized). */
+static vec4 vec4_cubic_derivative(const vec4 *coefficients, real t)
+{
+    vec4 step = vec4_init_from_1(t);
+    vec4 value = vec4_fma(vec4_mul_scalar(coefficients[3], 3.0f), step, vec4_mul_scalar(coefficients[2], 2.0f));
+    return vec4_fma(value, step, coefficients[1]);
+}
+
+/* Evaluate a vec4 cubic at `count` arbitrary parameters. */
+static void vec4_cubic_evaluate_array(const vec4 *coefficients, const real *t, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = vec4_cubic_evaluate(coefficients, t[i]);
+    }
+}
+
+/* Evaluate a vec4 cubic at t0, t0 + dt, ... (`count` samples) by forward differencing: three adds per
+   sample. Rounding error grows with count; restart per segment rather than over very long runs. */
+static void vec4_cubic_forward_difference(const vec4 *coefficients, real t0, real dt, vec4 *dst, u32 count)
+{
+    /* Differences of the polynomial re-centred on t0: f'(t0), f''(t0) / 2 and c3, scaled by powers of dt. */
+    real dt_squared = dt * dt;
+    vec4 slope = vec4_cubic_derivative(coefficients, t0);
+    vec4 half_curvature = vec4_fma(coefficients[3], vec4_init_from_1(3.0f * t0), coefficients[2]);
+    vec4 cubic = vec4_mul_scalar(coefficients[3], dt_squared * dt);
+    vec4 delta3 = vec4_mul_scalar(cubic, 6.0f);
+    vec4 delta2 = vec4_fma(half_curvature, vec4_init_from_1(2.0f * dt_squared), delta3);
+    vec4 delta1 = vec4_add(vec4_fma(half_curvature, vec4_init_from_1(dt_squared), vec4_mul_scalar(slope, dt)), cubic);
+    vec4 value = vec4_cubic_evaluate(coefficients, t0);
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = value;
+        value = vec4_add(value, delta1);
+        delta1 = vec4_add(delta1, delta2);
+        delta2 = vec4_add(delta2, delta3);
+    }
+}
+
+/* Catmull-Rom segment from p1 to p2 at t. */
+static vec4 vec4_catmull_rom(vec4 p0, vec4 p1, vec4 p2, vec4 p3, real t)
+{
+    vec4 coefficients[4];
+    vec4_cubic_coefficients(SPLINE_CATMULL_ROM, p0, p1, p2, p3, coefficients);
+    return vec4_cubic_evaluate(coefficients, t);
+}
+
+/* Hermite segment from p0 (tangent m0) to p1 (tangent m1) at t. */
+static vec4 vec4_hermite(vec4 p0, vec4 m0, vec4 p1, vec4 m1, real t)
+{
+    vec4 coefficients[4];
+    vec4_cubic_coefficients(SPLINE_HERMITE, p0, m0, p1, m1, coefficients);
+    return vec4_cubic_evaluate(coefficients, t);
+}
+
+/* Cubic Bezier from p0 to p1 with control points c0, c1 at t. */
+static vec4 vec4_bezier(vec4 p0, vec4 c0, vec4 c1, vec4 p1, real t)
+{
+    vec4 coefficients[4];
+    vec4_cubic_coefficients(SPLINE_BEZIER, p0, c0, c1, p1, coefficients);
+    return vec4_cubic_evaluate(coefficients, t);
+}
+
+/* Uniform cubic B-spline segment of p0..p3 at t. */
+static vec4 vec4_bspline(vec4 p0, vec4 p1, vec4 p2, vec4 p3, real t)
+{
+    vec4 coefficients[4];
+    vec4_cubic_coefficients(SPLINE_BSPLINE, p0, p1, p2, p3, coefficients);
+    return vec4_cubic_evaluate(coefficients, t);
+}
+
+/* Tessellate a curve through `point_count` points (Catmull-Rom or B-spline; the end points are repeated
+   so the curve spans the whole range) into `steps` samples per segment plus the final point.
+   dst needs (point_count - 1) * steps + 1 entries; returns the number written. */
+static u32 vec4_spline_tessellate(spline_basis basis, const vec4 *points, u32 point_count, u32 steps, vec4 *dst)
+{
+    real dt = 1.0f / (real)steps;
+    vec4 coefficients[4];
+    u32 segment;
+    if (point_count < 2 || steps == 0)
+    {
+        return 0;
+    }
+    for (segment = 0; segment + 1 < point_count; segment++)
+    {
+        vec4 p0 = points[segment > 0 ? segment - 1 : 0];
+        vec4 p3 = points[segment + 2 < point_count ? segment + 2 : point_count - 1];
+        vec4_cubic_coefficients(basis, p0, points[segment], points[segment + 1], p3, coefficients);
+        vec4_cubic_forward_difference(coefficients, 0.0f, dt, dst + segment * steps, steps);
+    }
+    dst[segment * steps] = vec4_cubic_evaluate(coefficients, 1.0f);
+    return segment * steps + 1;
+}
+
+/* ---- quaternions ---- */
+
+/* Inner control quaternion at key q for squad, from its neighbours: q * exp(-(log(q^-1 next) + log(q^-1 previous)) / 4). */
+static vec4 quat_squad_control(vec4 previous, vec4 q, vec4 next)
+{
+    vec4 inverse = quat_conjugate(q);
+    vec4 to_next = quat_mul(inverse, vec4_dot(q, next) < 0.0f ? vec4_negate(next) : next);
+    vec4 to_previous = quat_mul(inverse, vec4_dot(q, previous) < 0.0f ? vec4_negate(previous) : previous);
+    vec4 sum = vec4_add(quat_log(to_next), quat_log(to_previous));
+    return quat_mul(q, quat_exp(vec4_mul_scalar(sum, -0.25f)));
+}
+
+/* quat_slerp without the shortest-path sign flip: follows the arc from src0 to src1 as given. */
+static vec4 quat_slerp_no_flip(vec4 src0, vec4 src1, real factor)
+{
+    real dot = real_min(real_max(vec4_dot(src0, src1), -1.0f), 1.0f);
+    real theta, sin_theta;
+    if (real_abs(dot) >= (1.0f - (VECTORS_QUAT_EPSILON * 5.0f)))
+    {
+        return quat_nlerp(src0, src1, factor);
+    }
+    theta = real_acos(dot);
+    sin_theta = real_sin(theta);
+    return vec4_add(vec4_mul_scalar(src0, real_sin((1.0f - factor) * theta) / sin_theta),
+                    vec4_mul_scalar(src1, real_sin(factor * theta) / sin_theta));
+}
+
+/* Spherical quadrangle interpolation from q0 to q1 with inner controls a0, a1 (see quat_squad_control).
+   q1 and a1 are moved into q0's hemisphere once up front; after that none of the three slerps may flip,
+   or the curve jumps wherever the inner or blend term crosses a hemisphere. */
+static vec4 quat_squad(vec4 q0, vec4 a0, vec4 a1, vec4 q1, real t)
+{
+    vec4 outer, inner;
+    if (vec4_dot(q0, q1) < 0.0f)
+    {
+        q1 = vec4_negate(q1);
+        a1 = vec4_negate(a1);
+    }
+    outer = quat_slerp_no_flip(q0, q1, t);
+    inner = quat_slerp_no_flip(a0, a1, t);
+    return quat_slerp_no_flip(outer, inner, 2.0f * t * (1.0f - t));
+}
+
+/* squad of one segment at `count` parameters. */
+static void quat_squad_array(vec4 q0, vec4 a0, vec4 a1, vec4 q1, const real *t, vec4 *dst, u32 count)
+{
+    u32 i;
+    for (i = 0; i < count; i++)
+    {
+        dst[i] = quat_squad(q0, a0, a1, q1, t[i]);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VECTORS_SPLINE_H */